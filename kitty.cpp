@@ -11,10 +11,26 @@ kitty::kitty()
 {
     bitDepth = 32;
     sampleRate = 1.0;
+    heldCount = 0;
+
+    hostSampleRate = 44100.0;
+    secondsPerTick = 1.0 / (double) Time::getHighResolutionTicksPerSecond();
+    lastLoad = peakLoad = lastBlockMicros = 0;
+    lastBlockWasSilent = numSilentBlocks = peakResetPending = 0;
+
+    hasRetainedArtwork = false;
+    editorShowsSpectrum = false;
+    scopeCollector = 0;
+    spectrumCollector = 0;
 }
 
 kitty::~kitty()
 {
+    releaseScopeCollector();
+    releaseSpectrumCollector();
+
+    if (hasRetainedArtwork)
+        kittyEditor::releaseArtwork();
 }
 
 const String kitty::getName() const
@@ -42,24 +58,18 @@ float kitty::getParameter (int index)
 	return (0.0);
 }
 
+// (the editor polls the parameters, so nothing needs to be sent from here -
+//  this gets called on the audio thread during automation)
 void kitty::setParameter (int index, float newValue)
 {
 	if (index == kBitDepth)
 	{
-		if (bitDepth != roundFloatToInt(newValue))
-		{
-			bitDepth = (int)(newValue * 32);
-			sendChangeMessage (this);
-		}
-	} 
+		bitDepth = (int)(newValue * 32);
+	}
 
 	if (index == kSampleRate)
 	{
-		if (sampleRate != newValue)
-		{
-			sampleRate = newValue;
-			sendChangeMessage (this);
-		}
+		sampleRate = newValue;
 	}
 }
 
@@ -122,8 +132,10 @@ bool kitty::producesMidi() const
     return false;
 }
 
-void kitty::prepareToPlay (double sampleRate, int samplesPerBlock)
+void kitty::prepareToPlay (double rate, int samplesPerBlock)
 {
+    if (rate > 0)
+        hostSampleRate = rate;
 }
 
 void kitty::releaseResources()
@@ -133,17 +145,56 @@ void kitty::releaseResources()
 void kitty::processBlock (AudioSampleBuffer& buffer,
                                    MidiBuffer& midiMessages)
 {
-	y=cnt=0;
-	m=1<<(bitDepth-1);
+	const int64 startTime = Time::getHighResolutionTicks();
 
-	for (int channel = 0; channel < getNumInputChannels(); ++channel)
+	// decimate() turns silence into silence, so when the input is silent the
+	// buffer already holds our output and there's nothing to do
+	const bool silent = isSilent (buffer);
+
+	// The collectors only exist while an editor's showing them, so usually this
+	// is just two null checks. If there are any, the gate stops them from being
+	// deleted until this block's finished with them.
+	kittyScopeCollector* scope = 0;
+	kittySpectrumCollector* spectrum = 0;
+	bool collectorsEntered = false;
+
+	if ((scopeCollector != 0 || spectrumCollector != 0) && getNumInputChannels() > 0)
 	{
-		float *p = buffer.getSampleData (channel);
-		int size = buffer.getNumSamples();
+		collectorsEntered = collectorGate.tryToEnter();
 
-		for (int x=0; x<size; x++)
+		if (collectorsEntered)
 		{
-			*(p+x) = decimate (*(p+x));
+			scope = scopeCollector;
+			spectrum = spectrumCollector;
+			lockFreeMemoryBarrier();   // (don't touch the collectors before the pointers have been seen)
+		}
+	}
+
+	// (the scope and analyser only look at the first channel)
+	const bool feedScope = scope != 0 && scope->isActive();
+	const bool feedSpectrum = spectrum != 0 && spectrum->isActive();
+
+	if (feedScope)
+		scope->addInput (buffer.getSampleData (0), buffer.getNumSamples());
+
+	if (feedSpectrum)
+		spectrum->addInput (buffer.getSampleData (0), buffer.getNumSamples());
+
+	if (! silent)
+	{
+		y=cnt=0;
+		// (in 64 bits, so that 32 bits doesn't overflow the shift, or the truncation on LLP64)
+		m=((int64)1)<<(jmax (1, bitDepth)-1);
+
+		for (int channel = 0; channel < getNumInputChannels(); ++channel)
+		{
+			float *p = buffer.getSampleData (channel);
+			int size = buffer.getNumSamples();
+
+			for (int x=0; x<size; x++)
+			{
+				*(p+x) = decimate (*(p+x));
+			}
 		}
 	}
 
@@ -151,6 +202,70 @@ void kitty::processBlock (AudioSampleBuffer& buffer,
 	{
 		buffer.clear (i, 0, buffer.getNumSamples());
 	}
+
+	if (feedScope)
+		scope->addOutput (buffer.getSampleData (0), buffer.getNumSamples());
+
+	if (feedSpectrum)
+		spectrum->addOutput (buffer.getSampleData (0), buffer.getNumSamples());
+
+	if (collectorsEntered)
+		collectorGate.exit();
+
+	lastBlockWasSilent = silent ? 1 : 0;
+
+	if (silent)
+		++numSilentBlocks;
+
+	updateLoadStats (startTime, buffer.getNumSamples());
+}
+
+bool kitty::isSilent (AudioSampleBuffer& buffer) const
+{
+	const int size = buffer.getNumSamples();
+
+	for (int channel = 0; channel < getNumInputChannels(); ++channel)
+	{
+		const float* const p = buffer.getSampleData (channel);
+
+		// (a non-silent block will almost always bail out on its first sample)
+		for (int x = 0; x < size; ++x)
+			if (p[x] != 0)
+				return false;
+	}
+
+	return true;
+}
+
+void kitty::updateLoadStats (const int64 startTime, const int numSamples)
+{
+	const double seconds = (Time::getHighResolutionTicks() - startTime) * secondsPerTick;
+	const float load = (float) (seconds * hostSampleRate / jmax (1, numSamples));
+
+	lastLoad = load;
+	lastBlockMicros = (float) (seconds * 1.0e6);
+
+	// only this thread writes peakLoad - the reader just asks for it to be reset
+	if (peakResetPending != 0)
+	{
+		peakResetPending = 0;
+		peakLoad = load;
+	}
+	else if (load > peakLoad)
+	{
+		peakLoad = load;
+	}
+}
+
+void kitty::getLoadStats (float& load, float& peak, float& blockMicros, bool& lastWasSilent, int& numSilent)
+{
+	load = lastLoad;
+	peak = peakLoad;
+	blockMicros = lastBlockMicros;
+	lastWasSilent = lastBlockWasSilent != 0;
+	numSilent = numSilentBlocks;
+
+	peakResetPending = 1;
 }
 
 float kitty::decimate(float i)
@@ -159,37 +274,189 @@ float kitty::decimate(float i)
 	if (cnt >= 1)
 	{
 		cnt -= 1;
-		y = (long int)(i*m)/(float)m;
+		y = (int64)(i*m)/(float)m;
 	}
 
 	return y;
 }
 
+//==============================================================================
+kittyScopeCollector& kitty::createScopeCollector()
+{
+    if (scopeCollector == 0)
+    {
+        kittyScopeCollector* const newCollector = new kittyScopeCollector();
+        lockFreeMemoryBarrier();   // (it must be built before the audio thread can see it)
+        scopeCollector = newCollector;
+    }
+
+    return *scopeCollector;
+}
+
+void kitty::releaseScopeCollector()
+{
+    kittyScopeCollector* const oldCollector = scopeCollector;
+
+    if (oldCollector != 0)
+    {
+        {
+            // (this waits for a block that's using it to finish)
+            const ProcessingGate::ScopedClose gateClosed (collectorGate);
+            scopeCollector = 0;
+        }
+
+        delete oldCollector;
+    }
+}
+
+kittySpectrumCollector& kitty::createSpectrumCollector()
+{
+    if (spectrumCollector == 0)
+    {
+        kittySpectrumCollector* const newCollector = new kittySpectrumCollector();
+        lockFreeMemoryBarrier();
+        spectrumCollector = newCollector;
+    }
+
+    return *spectrumCollector;
+}
+
+void kitty::releaseSpectrumCollector()
+{
+    kittySpectrumCollector* const oldCollector = spectrumCollector;
+
+    if (oldCollector != 0)
+    {
+        {
+            const ProcessingGate::ScopedClose gateClosed (collectorGate);
+            spectrumCollector = 0;
+        }
+
+        delete oldCollector;
+    }
+}
+
+int kitty::decimateToHeldSamples (float** channels, const int numChannels, const int numSamples)
+{
+	// (the same quantising as decimate(), so the samples match what's heard)
+	const int64 levels = ((int64)1)<<(jmax (1, bitDepth)-1);
+	int numHeld = 0;
+
+	for (int x=0; x<numSamples; x++)
+	{
+		heldCount += sampleRate;
+
+		if (heldCount >= 1)
+		{
+			heldCount -= 1;
+
+			// (numHeld can't get ahead of x, so this can be done in place)
+			for (int channel = 0; channel < numChannels; ++channel)
+				channels[channel][numHeld] = (int64)(channels[channel][x]*levels)/(float)levels;
+
+			++numHeld;
+		}
+	}
+
+	return numHeld;
+}
+
+void kitty::resetHeldSamples()
+{
+	heldCount = 0;
+}
+
 AudioProcessorEditor* kitty::createEditor()
 {
+    // the artwork image is only built once an editor's actually wanted (from pixels
+    // that were decoded at build time), and then stays until the last instance that
+    // showed one goes away
+    if (! hasRetainedArtwork)
+    {
+        hasRetainedArtwork = true;
+        kittyEditor::retainArtwork();
+    }
+
     return new kittyEditor (this);
 }
 
+//==============================================================================
+/*  The state is saved as a fixed 16-byte block, all little-endian:
+
+        0   magic ('kitB')
+        4   version
+        8   bitDepth (int32)
+        12  sampleRate (float32)
+
+    Older versions saved a "kittySettings" xml element instead, which can still
+    be loaded. If a later version needs to add something, bump the version and
+    append the new fields - old fields must stay where they are.
+*/
+static const uint32 stateMagic = 0x4274696b;   // 'kitB' when read as bytes
+static const uint32 stateVersion = 1;
+static const int stateSize = 16;
+
+static void writeLittleEndian (uint8* dest, const uint32 value) throw()
+{
+    dest[0] = (uint8) value;
+    dest[1] = (uint8) (value >> 8);
+    dest[2] = (uint8) (value >> 16);
+    dest[3] = (uint8) (value >> 24);
+}
+
+static uint32 readLittleEndian (const uint8* src) throw()
+{
+    return ((uint32) src[0]) | (((uint32) src[1]) << 8) | (((uint32) src[2]) << 16) | (((uint32) src[3]) << 24);
+}
+
 void kitty::getStateInformation (MemoryBlock& destData)
 {
-    XmlElement xmlState (T("kittySettings"));
-    xmlState.setAttribute (T("bitDepth"), bitDepth);
-    xmlState.setAttribute (T("sampleRate"), sampleRate);
-    copyXmlToBinary (xmlState, destData);
+    destData.setSize (stateSize);
+    uint8* const d = (uint8*) destData.getData();
+
+    const float rate = sampleRate;
+    uint32 rateBits;
+    memcpy (&rateBits, &rate, sizeof (rateBits));
+
+    writeLittleEndian (d, stateMagic);
+    writeLittleEndian (d + 4, stateVersion);
+    writeLittleEndian (d + 8, (uint32) bitDepth);
+    writeLittleEndian (d + 12, rateBits);
 }
 
 void kitty::setStateInformation (const void* data, int sizeInBytes)
 {
-	XmlElement* const xmlState = getXmlFromBinary (data, sizeInBytes);
+    const uint8* const d = (const uint8*) data;
+
+    if (d != 0 && sizeInBytes >= stateSize && readLittleEndian (d) == stateMagic)
+    {
+        // (a newer version may have added more, but won't have moved these fields)
+        if (readLittleEndian (d + 4) >= 1)
+        {
+            const uint32 rateBits = readLittleEndian (d + 12);
+            float rate;
+            memcpy (&rate, &rateBits, sizeof (rate));
+
+            if (rate == rate)   // (skip NaNs)
+            {
+                bitDepth = jlimit (0, 32, (int) readLittleEndian (d + 8));
+                sampleRate = jlimit (0.0f, 1.0f, rate);
+            }
+        }
+
+        return;
+    }
+
+    // otherwise, this might be a chunk saved by an older version..
+    XmlElement* const xmlState = getXmlFromBinary (data, sizeInBytes);
 
     if (xmlState != 0)
     {
         if (xmlState->hasTagName (T("kittySettings")))
         {
-            bitDepth = xmlState->getIntAttribute (T("bitDepth"), bitDepth);
-            sampleRate = (float)xmlState->getDoubleAttribute (T("sampleRate"), sampleRate);
-
-            sendChangeMessage (this);
+            // (clamped like the binary state, as an old or hand-edited one could hold anything)
+            bitDepth = jlimit (0, 32, xmlState->getIntAttribute (T("bitDepth"), bitDepth));
+            sampleRate = jlimit (0.0f, 1.0f, (float)xmlState->getDoubleAttribute (T("sampleRate"), sampleRate));
         }
 
         delete xmlState;
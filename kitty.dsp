@@ -102,6 +102,18 @@ SOURCE=.\kitty.cpp
 
 SOURCE=.\kittyEditor.cpp
 # End Source File
+# Begin Source File
+
+SOURCE=.\kittyScope.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\kittySpectrum.cpp
+# End Source File
+# Begin Source File
+
+SOURCE=.\kittyArtwork.cpp
+# End Source File
 # End Group
 # Begin Group "Header Files"
 
@@ -122,6 +134,34 @@ SOURCE=.\kittyCharacteristics.h
 
 SOURCE=.\kittyEditor.h
 # End Source File
+# Begin Source File
+
+SOURCE=.\wrapper\juce_ProcessTimingHistogram.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\wrapper\juce_LockFreeFifo.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\wrapper\juce_ProcessingGate.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\wrapper\juce_StartupTimings.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\kittyScope.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\kittySpectrum.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\kittyArtwork.h
+# End Source File
 # End Group
 # Begin Group "Resource Files"
 
@@ -1,7 +1,11 @@
 #ifndef KITTY_H
 #define KITTY_H
 
-class kitty  : public AudioProcessor, public ChangeBroadcaster
+#include "kittyScope.h"
+#include "kittySpectrum.h"
+#include "wrapper/juce_ProcessingGate.h"
+
+class kitty  : public AudioProcessor
 {
 public:
     kitty();
@@ -47,6 +51,51 @@ public:
     void setBitDepth (int d);
     void setSampleRate (float r);
 
+    /** For exporting at the reduced rate: decimates a block of frames with the
+        current settings, but keeps only the samples that are held, packed at the
+        start of each channel, and returns how many frames that left.
+
+        Unlike processBlock(), all the channels are held at the same moments and
+        the position carries on from one block to the next, until it's started
+        again with resetHeldSamples().
+    */
+    int decimateToHeldSamples (float** channels, const int numChannels, const int numSamples);
+    void resetHeldSamples();
+
+    /** The rate that the held samples come at, for a given input rate. */
+    double getHeldSampleRate (const double inputRate) const     { return inputRate * sampleRate; }
+
+    /** The bit depth that the output is quantised to. */
+    int getBitDepth() const                                     { return bitDepth; }
+
+    /** Returns the figures for the load meter. Safe to call from any thread.
+
+        load is the time the last block took as a proportion of the time it
+        represents, and peakLoad is the highest load since the last call to
+        this method.
+    */
+    void getLoadStats (float& load, float& peakLoad, float& blockMicros, bool& lastBlockWasSilent, int& numSilentBlocks);
+
+    /** Creates the collector for the editor's scope, and hands it to the audio thread.
+
+        The collectors are only needed while something is looking at them, so an
+        instance that never shows its editor doesn't allocate them at all. The scope
+        calls this when it starts, and releaseScopeCollector() once it's switched
+        the collector off.
+    */
+    kittyScopeCollector& createScopeCollector();
+
+    /** Takes the scope's collector away from the audio thread and deletes it. */
+    void releaseScopeCollector();
+
+    /** Like createScopeCollector(), for the spectrum analyser's samples. */
+    kittySpectrumCollector& createSpectrumCollector();
+    void releaseSpectrumCollector();
+
+    /** Whether the editor was last showing the spectrum instead of the scope. */
+    bool getEditorShowsSpectrum() const throw()                 { return editorShowsSpectrum; }
+    void setEditorShowsSpectrum (const bool shows) throw()      { editorShowsSpectrum = shows; }
+
     juce_UseDebuggingNewOperator
 
 private:
@@ -55,7 +104,19 @@ private:
     float cnt;
     float sampleRate;
     int bitDepth;
-    long m;
+    int64 m;
+    float heldCount;
+
+    double hostSampleRate, secondsPerTick;
+    volatile float lastLoad, peakLoad, lastBlockMicros;
+    volatile int lastBlockWasSilent, numSilentBlocks, peakResetPending;
+    bool hasRetainedArtwork, editorShowsSpectrum;
+    kittyScopeCollector* volatile scopeCollector;
+    kittySpectrumCollector* volatile spectrumCollector;
+    ProcessingGate collectorGate;
+
+    bool isSilent (AudioSampleBuffer& buffer) const;
+    void updateLoadStats (const int64 startTime, const int numSamples);
 };
 
 #endif
@@ -0,0 +1,2055 @@
+// generated from the png in kittyEditor.cpp by tools/kittyArtworkPixels.py - don't edit
+
+#include "kittyArtwork.h"
+
+const uint32 kittyArtworkPixels [kittyArtworkWidth * kittyArtworkHeight] =
+{
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x07000000, 0x17000000, 0x23000000, 0x31020202, 0x45010101,
+    0x57000000, 0x51000000, 0x16000000, 0x04000000, 0x04000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x44010101, 0xa1020202, 0xce090909, 0xe30c0c0c, 0xec0d0d0d, 0xf10d0d0d,
+    0xee0d0d0d, 0xe8060606, 0x92010101, 0x21000000, 0x0e000000, 0x06000000, 0x01000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x25020202, 0x9a060606, 0xf3101010, 0xff2a2a2a, 0xff333333, 0xff323232, 0xff303030, 0xff2e2e2e,
+    0xff2b2b2b, 0xff242424, 0xfd0b0b0b, 0xa2030303, 0x31000000, 0x14000000, 0x07000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x66040404,
+    0xdd0e0e0e, 0xff222222, 0xff3c3c3c, 0xff404040, 0xff3a3a3a, 0xff373737, 0xff343434, 0xff303030,
+    0xff303030, 0xff323232, 0xff232323, 0xff090909, 0x98040404, 0x2e000000, 0x13000000, 0x06000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2a000000, 0xa7040404, 0xfc171717,
+    0xff343434, 0xff424242, 0xff414141, 0xff383838, 0xff353535, 0xff343434, 0xff333333, 0xff363636,
+    0xff323232, 0xff252525, 0xff161616, 0xff0b0b0b, 0xe4040404, 0x59010101, 0x28000000, 0x0f000000,
+    0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3a000000, 0xcd060606, 0xff252525, 0xff414141,
+    0xff434343, 0xff3c3c3c, 0xff363636, 0xff343434, 0xff313131, 0xff333333, 0xff363636, 0xff2a2a2a,
+    0xff131313, 0xff161616, 0xff2b2b2b, 0xff313131, 0xf40c0c0c, 0x84020202, 0x41000000, 0x1c000000,
+    0x07000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x39010101, 0xda080808, 0xff2e2e2e, 0xff454545, 0xff414141,
+    0xff3b3b3b, 0xff353535, 0xff323232, 0xff2f2f2f, 0xff313131, 0xff343434, 0xff1d1d1d, 0xff141414,
+    0xff313131, 0xff4e4e4e, 0xff545454, 0xff525252, 0xff1f1f1f, 0xaf040404, 0x54000000, 0x2b000000,
+    0x0c000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x45020202, 0xdf090909, 0xff2d2d2d, 0xff424242, 0xff3e3e3e, 0xff383838,
+    0xff343434, 0xff2f2f2f, 0xff2d2d2d, 0xff2d2d2d, 0xff2e2e2e, 0xff171717, 0xff1a1a1a, 0xff474747,
+    0xff5e5e5e, 0xff666666, 0xff6b6b6b, 0xff6c6c6c, 0xff3b3b3b, 0xcf060606, 0x66000000, 0x38000000,
+    0x13000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x54070707, 0xe90e0e0e, 0xff2c2c2c, 0xff404040, 0xff3c3c3c, 0xff363636, 0xff313131,
+    0xff2d2d2d, 0xff282828, 0xff2b2b2b, 0xff2d2d2d, 0xff161616, 0xff1f1f1f, 0xff4e4e4e, 0xff656565,
+    0xff727272, 0xff7d7d7d, 0xff808080, 0xff7f7f7f, 0xff535353, 0xe1070707, 0x75000000, 0x43000000,
+    0x19000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4c060606, 0xeb0f0f0f, 0xff292929, 0xff3e3e3e, 0xff3a3a3a, 0xff363636, 0xff303030, 0xff2a2a2a,
+    0xff272727, 0xff262626, 0xff2c2c2c, 0xff202020, 0xff141414, 0xff494949, 0xff646464, 0xff777777,
+    0xff878787, 0xff8e8e8e, 0xff8f8f8f, 0xff8d8d8d, 0xff5f5f5f, 0xe4080808, 0x7d000000, 0x4d000000,
+    0x20000000, 0x07000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x39010101,
+    0xe50a0a0a, 0xff292929, 0xff3e3e3e, 0xff393939, 0xff343434, 0xff2f2f2f, 0xff2a2a2a, 0xff252525,
+    0xff232323, 0xff272727, 0xff2a2a2a, 0xff0f0f0f, 0xff303030, 0xff5e5e5e, 0xff747474, 0xff898989,
+    0xff969696, 0xff9c9c9c, 0xff9b9b9b, 0xff979797, 0xff6a6a6a, 0xe60b0b0b, 0x81000000, 0x52000000,
+    0x25000000, 0x08000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1a000000, 0xce060606,
+    0xff292929, 0xff3e3e3e, 0xff3a3a3a, 0xff343434, 0xff2e2e2e, 0xff292929, 0xff252525, 0xff222222,
+    0xff212121, 0xff262626, 0xff1c1c1c, 0xff171717, 0xff4f4f4f, 0xff6b6b6b, 0xff838383, 0xff949494,
+    0xff9f9f9f, 0xffa3a3a3, 0xffa0a0a0, 0xff9c9c9c, 0xff737373, 0xea0d0d0d, 0x84000000, 0x55000000,
+    0x28000000, 0x09000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x9e020202, 0xff1e1e1e,
+    0xff3d3d3d, 0xff393939, 0xff353535, 0xff2f2f2f, 0xff292929, 0xff242424, 0xff1f1f1f, 0xff1e1e1e,
+    0xff212121, 0xff232323, 0xff0f0f0f, 0xff333333, 0xff5e5e5e, 0xff787878, 0xff8d8d8d, 0xff9c9c9c,
+    0xffa5a5a5, 0xffa8a8a8, 0xffa4a4a4, 0xff9c9c9c, 0xff757575, 0xed0f0f0f, 0x86000000, 0x58000000,
+    0x2a000000, 0x0a000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x69020202, 0xf8131313, 0xff383838,
+    0xff3a3a3a, 0xff343434, 0xff2f2f2f, 0xff2a2a2a, 0xff252525, 0xff1f1f1f, 0xff1a1a1a, 0xff1b1b1b,
+    0xff202020, 0xff141414, 0xff171717, 0xff4a4a4a, 0xff676767, 0xff808080, 0xff929292, 0xffa0a0a0,
+    0xffa7a7a7, 0xffa8a8a8, 0xffa3a3a3, 0xff9a9a9a, 0xff787878, 0xef101010, 0x89000000, 0x58000000,
+    0x2b000000, 0x0b000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3b000000, 0xe7090909, 0xff2f2f2f, 0xff3a3a3a,
+    0xff353535, 0xff303030, 0xff2a2a2a, 0xff252525, 0xff202020, 0xff191919, 0xff181818, 0xff1a1a1a,
+    0xff1b1b1b, 0xff0b0b0b, 0xff2f2f2f, 0xff535353, 0xff6f6f6f, 0xff858585, 0xff969696, 0xffa1a1a1,
+    0xffa6a6a6, 0xffa5a5a5, 0xff9d9d9d, 0xff929292, 0xff727272, 0xf4101010, 0x8c000000, 0x5b000000,
+    0x2d000000, 0x0b000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x03000000, 0x02000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x15000000, 0xbc040404, 0xff262626, 0xff3a3a3a, 0xff353535,
+    0xff313131, 0xff2b2b2b, 0xff272727, 0xff202020, 0xff1a1a1a, 0xff161616, 0xff151515, 0xff191919,
+    0xff0f0f0f, 0xff151515, 0xff3c3c3c, 0xff585858, 0xff737373, 0xff868686, 0xff959595, 0xff9e9e9e,
+    0xffa2a2a2, 0xff9e9e9e, 0xff959595, 0xff888888, 0xff565656, 0xe70a0a0a, 0x87010101, 0x5d000000,
+    0x2e000000, 0x0c000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000000,
+    0x8d010101, 0xb5040404, 0xae040404, 0xa5030303, 0x96010101, 0x6d000000, 0x33000000, 0x0c000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05000000,
+    0x22000000, 0x2f000000, 0x28000000, 0x2a000000, 0x29000000, 0x29000000, 0x29000000, 0x27000000,
+    0x20000000, 0x19000000, 0x11000000, 0x0a000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x08000000, 0x46010101, 0xb3030303, 0xff1b1b1b, 0xff393939, 0xff363636, 0xff313131,
+    0xff2c2c2c, 0xff272727, 0xff212121, 0xff1a1a1a, 0xff161616, 0xff141414, 0xff131313, 0xff131313,
+    0xff090909, 0xff232323, 0xff414141, 0xff5b5b5b, 0xff727272, 0xff848484, 0xff919191, 0xff989898,
+    0xff9a9a9a, 0xff939393, 0xff888888, 0xff797979, 0xff353535, 0xc4010101, 0x7b000000, 0x5b000000,
+    0x2b000000, 0x0a000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6c000000,
+    0xf70e0e0e, 0xff393939, 0xff3c3c3c, 0xff333333, 0xff2b2b2b, 0xfd1d1d1d, 0xde0a0a0a, 0xa3010101,
+    0x61000000, 0x2a000000, 0x09000000, 0x00000000, 0x01000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x23000000, 0x4c000000, 0x79010101, 0x96020202, 0xaf030303,
+    0xdb050505, 0xec090909, 0xe10b0b0b, 0xe10b0b0b, 0xe10b0b0b, 0xe10b0b0b, 0xdf0a0a0a, 0xd7080808,
+    0xc9050505, 0xbe030303, 0xb5010101, 0xac010101, 0xa3010101, 0x9a000000, 0x8f000000, 0x84000000,
+    0x7b000000, 0xad040404, 0xf4111111, 0xff252525, 0xff373737, 0xff383838, 0xff323232, 0xff2d2d2d,
+    0xff272727, 0xff212121, 0xff1c1c1c, 0xff161616, 0xff121212, 0xff0f0f0f, 0xff111111, 0xff0c0c0c,
+    0xff0b0b0b, 0xff2b2b2b, 0xff434343, 0xff5b5b5b, 0xff6e6e6e, 0xff7e7e7e, 0xff8a8a8a, 0xff8e8e8e,
+    0xff8d8d8d, 0xff878787, 0xff7b7b7b, 0xff626262, 0xfa191919, 0xa9000000, 0x74000000, 0x53000000,
+    0x24000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13000000, 0xc6020202,
+    0xff090909, 0xff1e1e1e, 0xff4e4e4e, 0xff606060, 0xff575757, 0xff4c4c4c, 0xff3b3b3b, 0xff282828,
+    0xf6121212, 0xd8060606, 0x98010101, 0x40000000, 0x0d000000, 0x01000000, 0x01000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x30000000, 0x8b010101, 0xd6080808, 0xf0151515, 0xff222222, 0xff2b2b2b, 0xff333333,
+    0xff343434, 0xff353535, 0xff373737, 0xff343434, 0xff343434, 0xff333333, 0xff323232, 0xff323232,
+    0xff303030, 0xff2f2f2f, 0xff2f2f2f, 0xff2e2e2e, 0xff2d2d2d, 0xfe2b2b2b, 0xfa242424, 0xf9202020,
+    0xfb1d1d1d, 0xff282828, 0xff383838, 0xff3d3d3d, 0xff383838, 0xff333333, 0xff2e2e2e, 0xff272727,
+    0xff222222, 0xff1c1c1c, 0xff171717, 0xff121212, 0xff0f0f0f, 0xff0c0c0c, 0xff0d0d0d, 0xff070707,
+    0xff111111, 0xff2a2a2a, 0xff424242, 0xff575757, 0xff686868, 0xff767676, 0xff808080, 0xff828282,
+    0xff7f7f7f, 0xff767676, 0xff6a6a6a, 0xff484848, 0xed0b0b0b, 0x91010101, 0x6c000000, 0x43000000,
+    0x18000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60000000, 0xf9202020,
+    0xff555555, 0xff3a3a3a, 0xff1d1d1d, 0xff3f3f3f, 0xff616161, 0xff5a5a5a, 0xff4e4e4e, 0xff454545,
+    0xff3b3b3b, 0xff2d2d2d, 0xff1a1a1a, 0xeb070707, 0xa0010101, 0x49000000, 0x10000000, 0x02000000,
+    0x02000000, 0x01000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2f000000,
+    0x8a000000, 0xe00c0c0c, 0xff292929, 0xff414141, 0xff4b4b4b, 0xff4a4a4a, 0xff4a4a4a, 0xff484848,
+    0xff464646, 0xff434343, 0xff404040, 0xff3d3d3d, 0xff3b3b3b, 0xff393939, 0xff383838, 0xff373737,
+    0xff383838, 0xff393939, 0xff3b3b3b, 0xff3c3c3c, 0xff3e3e3e, 0xff404040, 0xff414141, 0xff414141,
+    0xff404040, 0xff3f3f3f, 0xff3c3c3c, 0xff373737, 0xff323232, 0xff2d2d2d, 0xff282828, 0xff222222,
+    0xff1d1d1d, 0xff171717, 0xff121212, 0xff0e0e0e, 0xff0b0b0b, 0xff0b0b0b, 0xff090909, 0xff050505,
+    0xff171717, 0xff282828, 0xff3d3d3d, 0xff505050, 0xff5f5f5f, 0xff6c6c6c, 0xff737373, 0xff747474,
+    0xff717171, 0xff676767, 0xff565656, 0xff2a2a2a, 0xd5040404, 0x86010101, 0x6b000000, 0x3e000000,
+    0x16000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000, 0xb8030303, 0xff4f4f4f,
+    0xff7b7b7b, 0xff7e7e7e, 0xff606060, 0xff272727, 0xff2e2e2e, 0xff5c5c5c, 0xff565656, 0xff484848,
+    0xff3f3f3f, 0xff3a3a3a, 0xff363636, 0xff2d2d2d, 0xff1b1b1b, 0xed0a0a0a, 0xa3010101, 0x46000000,
+    0x0e000000, 0x05000000, 0x03000000, 0x00000000, 0x00000000, 0x0e000000, 0x73000000, 0xdd080808,
+    0xfe272727, 0xff434343, 0xff4d4d4d, 0xff4d4d4d, 0xff4b4b4b, 0xff484848, 0xff464646, 0xff434343,
+    0xff3f3f3f, 0xff3c3c3c, 0xff383838, 0xff353535, 0xff333333, 0xff303030, 0xff2f2f2f, 0xff2f2f2f,
+    0xff2e2e2e, 0xff2f2f2f, 0xff323232, 0xff333333, 0xff353535, 0xff373737, 0xff393939, 0xff393939,
+    0xff383838, 0xff363636, 0xff333333, 0xff303030, 0xff2c2c2c, 0xff272727, 0xff222222, 0xff1c1c1c,
+    0xff171717, 0xff131313, 0xff0e0e0e, 0xff0a0a0a, 0xff070707, 0xff080808, 0xff060606, 0xff060606,
+    0xff161616, 0xff242424, 0xff373737, 0xff474747, 0xff545454, 0xff606060, 0xff646464, 0xff646464,
+    0xff545454, 0xff3c3c3c, 0xff262626, 0xfd0a0a0a, 0xe0000000, 0xcd000000, 0xc5000000, 0xb1000000,
+    0x9a000000, 0x83000000, 0x56000000, 0x1e000000, 0x05000000, 0x04000000, 0x02000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05000000, 0xbd050505, 0xff5e5e5e,
+    0xff868686, 0xff8a8a8a, 0xff8e8e8e, 0xff797979, 0xff323232, 0xff2f2f2f, 0xff5b5b5b, 0xff505050,
+    0xff424242, 0xff3a3a3a, 0xff373737, 0xff353535, 0xff333333, 0xff2c2c2c, 0xff1c1c1c, 0xe8070707,
+    0x89000000, 0x2c000000, 0x0a000000, 0x00000000, 0x2e000000, 0xaa010101, 0xf6191919, 0xff3b3b3b,
+    0xff494949, 0xff4a4a4a, 0xff484848, 0xff464646, 0xff454545, 0xff434343, 0xff404040, 0xff3c3c3c,
+    0xff383838, 0xff343434, 0xff313131, 0xff2d2d2d, 0xff2a2a2a, 0xff282828, 0xff262626, 0xff252525,
+    0xff252525, 0xff262626, 0xff282828, 0xff292929, 0xff2c2c2c, 0xff2d2d2d, 0xff2f2f2f, 0xff2f2f2f,
+    0xff2f2f2f, 0xff2d2d2d, 0xff2b2b2b, 0xff272727, 0xff242424, 0xff1f1f1f, 0xff1a1a1a, 0xff161616,
+    0xff111111, 0xff0d0d0d, 0xff0a0a0a, 0xff070707, 0xff050505, 0xff060606, 0xff040404, 0xff080808,
+    0xff111111, 0xff1f1f1f, 0xff303030, 0xff3d3d3d, 0xff4a4a4a, 0xff4e4e4e, 0xff3e3e3e, 0xff282828,
+    0xff1a1a1a, 0xff181818, 0xff141414, 0xec010101, 0xb8000000, 0xa0000000, 0x8c000000, 0x83000000,
+    0x89000000, 0x99000000, 0xb8000000, 0xbe000000, 0x6e000000, 0x12000000, 0x0a000000, 0x03000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000, 0xa4010101, 0xff535353,
+    0xff909090, 0xff939393, 0xff969696, 0xff969696, 0xff7f7f7f, 0xff292929, 0xff373737, 0xff575757,
+    0xff474747, 0xff3c3c3c, 0xff373737, 0xff343434, 0xff333333, 0xff343434, 0xff363636, 0xff2d2d2d,
+    0xfd131313, 0xc0020202, 0x57000000, 0x5a000000, 0xcd040404, 0xfe242424, 0xff404040, 0xff454545,
+    0xff424242, 0xff404040, 0xff3f3f3f, 0xff3d3d3d, 0xff3b3b3b, 0xff393939, 0xff363636, 0xff333333,
+    0xff2d2d2d, 0xff2b2b2b, 0xff272727, 0xff232323, 0xff212121, 0xff1e1e1e, 0xff1d1d1d, 0xff1b1b1b,
+    0xff1c1c1c, 0xff1d1d1d, 0xff1e1e1e, 0xff1f1f1f, 0xff212121, 0xff232323, 0xff242424, 0xff242424,
+    0xff252525, 0xff242424, 0xff222222, 0xff1e1e1e, 0xff1c1c1c, 0xff181818, 0xff151515, 0xff101010,
+    0xff0c0c0c, 0xff0a0a0a, 0xff060606, 0xff050505, 0xff030303, 0xff040404, 0xff050505, 0xff0a0a0a,
+    0xff101010, 0xff1c1c1c, 0xff282828, 0xff343434, 0xff343434, 0xff1d1d1d, 0xff141414, 0xff252525,
+    0xff313131, 0xff343434, 0xff171717, 0xc4010101, 0x82000000, 0x76000000, 0x63000000, 0x51000000,
+    0x47000000, 0x45000000, 0x52000000, 0x80000000, 0x7e000000, 0x31000000, 0x1a000000, 0x09000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x89000000, 0xfd474747,
+    0xff949494, 0xff9a9a9a, 0xff9d9d9d, 0xff9b9b9b, 0xff979797, 0xff6b6b6b, 0xff1f1f1f, 0xff444444,
+    0xff4f4f4f, 0xff3f3f3f, 0xff363636, 0xff323232, 0xff303030, 0xff323232, 0xff333333, 0xff353535,
+    0xff333333, 0xff202020, 0xed070707, 0xe70a0a0a, 0xfb282828, 0xff3d3d3d, 0xff3c3c3c, 0xff3a3a3a,
+    0xff393939, 0xff373737, 0xff343434, 0xff323232, 0xff2f2f2f, 0xff2c2c2c, 0xff292929, 0xff262626,
+    0xff232323, 0xff202020, 0xff1c1c1c, 0xff1a1a1a, 0xff171717, 0xff141414, 0xff131313, 0xff121212,
+    0xff131313, 0xff141414, 0xff151515, 0xff161616, 0xff171717, 0xff191919, 0xff1a1a1a, 0xff1a1a1a,
+    0xff1b1b1b, 0xff1a1a1a, 0xff181818, 0xff151515, 0xff131313, 0xff111111, 0xff0d0d0d, 0xff0a0a0a,
+    0xff080808, 0xff060606, 0xff040404, 0xff030303, 0xff020202, 0xff030303, 0xff050505, 0xff080808,
+    0xff0d0d0d, 0xff171717, 0xff212121, 0xff1c1c1c, 0xff0e0e0e, 0xff191919, 0xff323232, 0xff3b3b3b,
+    0xff383838, 0xff262626, 0xf3060606, 0x9a010101, 0x7a000000, 0x64000000, 0x48000000, 0x39000000,
+    0x34000000, 0x36000000, 0x38000000, 0x3b000000, 0x42000000, 0x3d000000, 0x25000000, 0x0e000000,
+    0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x71000000, 0xff414141,
+    0xff959595, 0xff9c9c9c, 0xffa0a0a0, 0xff9f9f9f, 0xff9a9a9a, 0xff929292, 0xff575757, 0xff1c1c1c,
+    0xff434343, 0xff424242, 0xff363636, 0xff2f2f2f, 0xff2e2e2e, 0xff272727, 0xff2a2a2a, 0xff2e2e2e,
+    0xff2e2e2e, 0xff313131, 0xff2a2a2a, 0xff2d2d2d, 0xff343434, 0xff323232, 0xff303030, 0xff2f2f2f,
+    0xff2d2d2d, 0xff2a2a2a, 0xff282828, 0xff262626, 0xff222222, 0xff202020, 0xff1f1f1f, 0xff1c1c1c,
+    0xff181818, 0xff151515, 0xff121212, 0xff111111, 0xff0f0f0f, 0xff0d0d0d, 0xff0c0c0c, 0xff0c0c0c,
+    0xff0a0a0a, 0xff0b0b0b, 0xff0d0d0d, 0xff0e0e0e, 0xff0f0f0f, 0xff111111, 0xff121212, 0xff121212,
+    0xff121212, 0xff121212, 0xff101010, 0xff0e0e0e, 0xff0d0d0d, 0xff0b0b0b, 0xff090909, 0xff060606,
+    0xff040404, 0xff040404, 0xff030303, 0xff020202, 0xff020202, 0xff030303, 0xff030303, 0xff050505,
+    0xff0a0a0a, 0xff121212, 0xff1b1b1b, 0xff161616, 0xff1e1e1e, 0xff2f2f2f, 0xff313131, 0xff313131,
+    0xff2f2f2f, 0xff141414, 0xc3020202, 0x7f000000, 0x6c000000, 0x45000000, 0x24000000, 0x15000000,
+    0x12000000, 0x14000000, 0x18000000, 0x1f000000, 0x27000000, 0x28000000, 0x1b000000, 0x0b000000,
+    0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x52000000, 0xfb2c2c2c,
+    0xff8b8b8b, 0xff9b9b9b, 0xffa0a0a0, 0xffa0a0a0, 0xff9c9c9c, 0xff959595, 0xff878787, 0xff3f3f3f,
+    0xff202020, 0xff414141, 0xff363636, 0xff2e2e2e, 0xff242424, 0xff0e0e0e, 0xff1c1c1c, 0xff272727,
+    0xff262626, 0xff272727, 0xff292929, 0xff282828, 0xff272727, 0xff262626, 0xff252525, 0xff242424,
+    0xff212121, 0xff1f1f1f, 0xff1c1c1c, 0xff1a1a1a, 0xff171717, 0xff161616, 0xff131313, 0xff111111,
+    0xff0f0f0f, 0xff0c0c0c, 0xff0c0c0c, 0xff0a0a0a, 0xff080808, 0xff080808, 0xff070707, 0xff070707,
+    0xff070707, 0xff060606, 0xff070707, 0xff090909, 0xff090909, 0xff0a0a0a, 0xff0c0c0c, 0xff0c0c0c,
+    0xff0c0c0c, 0xff0c0c0c, 0xff0a0a0a, 0xff0a0a0a, 0xff080808, 0xff070707, 0xff050505, 0xff040404,
+    0xff030303, 0xff020202, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff030303, 0xff040404,
+    0xff070707, 0xff0e0e0e, 0xff151515, 0xff1b1b1b, 0xff222222, 0xff272727, 0xff2a2a2a, 0xff2a2a2a,
+    0xff1e1e1e, 0xf1060606, 0xac000000, 0x85000000, 0x59000000, 0x2a000000, 0x0d000000, 0x03000000,
+    0x03000000, 0x03000000, 0x04000000, 0x08000000, 0x0c000000, 0x0e000000, 0x0a000000, 0x04000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x28000000, 0xd20c0c0c,
+    0xff707070, 0xff989898, 0xff9d9d9d, 0xff9f9f9f, 0xff9e9e9e, 0xff979797, 0xff8b8b8b, 0xff717171,
+    0xff262626, 0xff292929, 0xff383838, 0xff2a2a2a, 0xff101010, 0xff0e0e0e, 0xff1f1f1f, 0xff1e1e1e,
+    0xff1e1e1e, 0xff1e1e1e, 0xff1e1e1e, 0xff1e1e1e, 0xff1e1e1e, 0xff1c1c1c, 0xff1a1a1a, 0xff191919,
+    0xff171717, 0xff151515, 0xff121212, 0xff101010, 0xff101010, 0xff0d0d0d, 0xff0d0d0d, 0xff0c0c0c,
+    0xff0a0a0a, 0xff090909, 0xff080808, 0xff060606, 0xff040404, 0xff050505, 0xff050505, 0xff040404,
+    0xff030303, 0xff040404, 0xff040404, 0xff050505, 0xff070707, 0xff080808, 0xff070707, 0xff090909,
+    0xff0a0a0a, 0xff0a0a0a, 0xff080808, 0xff080808, 0xff070707, 0xff060606, 0xff040404, 0xff040404,
+    0xff020202, 0xff020202, 0xff020202, 0xff000000, 0xff010101, 0xff020202, 0xff020202, 0xff030303,
+    0xff060606, 0xff0a0a0a, 0xff0f0f0f, 0xff151515, 0xff1c1c1c, 0xff1d1d1d, 0xff131313, 0xff101010,
+    0xfe0a0a0a, 0xf8000000, 0xe1000000, 0xce000000, 0xb1000000, 0x78000000, 0x39000000, 0x15000000,
+    0x01000000, 0x00000000, 0x01000000, 0x01000000, 0x02000000, 0x02000000, 0x02000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07000000, 0x9a010101,
+    0xff4a4a4a, 0xff8f8f8f, 0xff979797, 0xff9c9c9c, 0xff9b9b9b, 0xff959595, 0xff8a8a8a, 0xff7e7e7e,
+    0xff535353, 0xff141414, 0xff292929, 0xff222222, 0xff090909, 0xff161616, 0xff191919, 0xff161616,
+    0xff161616, 0xff151515, 0xff151515, 0xff151515, 0xff131313, 0xff121212, 0xff101010, 0xff0f0f0f,
+    0xff0f0f0f, 0xff0c0c0c, 0xff0a0a0a, 0xff0b0b0b, 0xff0a0a0a, 0xff090909, 0xff080808, 0xff060606,
+    0xff060606, 0xff070707, 0xff050505, 0xff060606, 0xff050505, 0xff030303, 0xff030303, 0xff030303,
+    0xff010101, 0xff020202, 0xff020202, 0xff030303, 0xff050505, 0xff070707, 0xff070707, 0xff090909,
+    0xff0a0a0a, 0xff0a0a0a, 0xff0a0a0a, 0xff080808, 0xff070707, 0xff060606, 0xff050505, 0xff040404,
+    0xff020202, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff010101, 0xff010101, 0xff030303,
+    0xff050505, 0xff070707, 0xff0b0b0b, 0xff101010, 0xff171717, 0xff1b1b1b, 0xff171717, 0xff1b1b1b,
+    0xff222222, 0xfd1a1a1a, 0xf0050505, 0xc5000000, 0xa9000000, 0xbc000000, 0xc9000000, 0xb1000000,
+    0x86000000, 0x43000000, 0x0a000000, 0x03000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55000000,
+    0xf7242424, 0xff7c7c7c, 0xff8f8f8f, 0xff939393, 0xff949494, 0xff909090, 0xff888888, 0xff7c7c7c,
+    0xff6c6c6c, 0xff363636, 0xff121212, 0xff121212, 0xff0d0d0d, 0xff171717, 0xff121212, 0xff0f0f0f,
+    0xff0e0e0e, 0xff0e0e0e, 0xff0d0d0d, 0xff0d0d0d, 0xff0c0c0c, 0xff0b0b0b, 0xff090909, 0xff090909,
+    0xff070707, 0xff070707, 0xff070707, 0xff080808, 0xff070707, 0xff080808, 0xff080808, 0xff070707,
+    0xff070707, 0xff070707, 0xff060606, 0xff070707, 0xff060606, 0xff040404, 0xff030303, 0xff040404,
+    0xff030303, 0xff030303, 0xff030303, 0xff040404, 0xff050505, 0xff070707, 0xff080808, 0xff0a0a0a,
+    0xff0b0b0b, 0xff0c0c0c, 0xff0c0c0c, 0xff0c0c0c, 0xff0a0a0a, 0xff080808, 0xff070707, 0xff050505,
+    0xff040404, 0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff010101, 0xff020202,
+    0xff030303, 0xff060606, 0xff090909, 0xff0c0c0c, 0xff121212, 0xff191919, 0xff212121, 0xff262626,
+    0xff2a2a2a, 0xff2d2d2d, 0xff212121, 0xf50a0a0a, 0xb4000000, 0x73000000, 0x71000000, 0x8b000000,
+    0xac000000, 0xc6000000, 0x8a000000, 0x2b000000, 0x09000000, 0x05000000, 0x02000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20000000,
+    0xcc090909, 0xff5a5a5a, 0xff838383, 0xff878787, 0xff8b8b8b, 0xff898989, 0xff838383, 0xff777777,
+    0xff6a6a6a, 0xff535353, 0xff171717, 0xff030303, 0xff141414, 0xff111111, 0xff0c0c0c, 0xff0a0a0a,
+    0xff090909, 0xff090909, 0xff070707, 0xff070707, 0xff070707, 0xff070707, 0xff060606, 0xff060606,
+    0xff050505, 0xff060606, 0xff070707, 0xff070707, 0xff090909, 0xff080808, 0xff090909, 0xff0b0b0b,
+    0xff090909, 0xff080808, 0xff090909, 0xff090909, 0xff080808, 0xff070707, 0xff060606, 0xff050505,
+    0xff050505, 0xff050505, 0xff060606, 0xff060606, 0xff080808, 0xff0a0a0a, 0xff0c0c0c, 0xff0e0e0e,
+    0xff0f0f0f, 0xff101010, 0xff0f0f0f, 0xff0f0f0f, 0xff0e0e0e, 0xff0c0c0c, 0xff0a0a0a, 0xff080808,
+    0xff060606, 0xff050505, 0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff010101,
+    0xff020202, 0xff040404, 0xff060606, 0xff0b0b0b, 0xff101010, 0xff151515, 0xff171717, 0xff181818,
+    0xff232323, 0xff2a2a2a, 0xff2d2d2d, 0xff252525, 0xfe0e0e0e, 0xce010101, 0x82000000, 0x60000000,
+    0x52000000, 0x6e000000, 0xba000000, 0xbf000000, 0x55000000, 0x14000000, 0x08000000, 0x04000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000,
+    0x85000000, 0xfd2b2b2b, 0xff707070, 0xff7a7a7a, 0xff7e7e7e, 0xff7e7e7e, 0xff7a7a7a, 0xff717171,
+    0xff636363, 0xff545454, 0xff292929, 0xff020202, 0xff0f0f0f, 0xff0e0e0e, 0xff080808, 0xff060606,
+    0xff050505, 0xff050505, 0xff050505, 0xff040404, 0xff030303, 0xff040404, 0xff040404, 0xff050505,
+    0xff050505, 0xff060606, 0xff080808, 0xff080808, 0xff0a0a0a, 0xff0c0c0c, 0xff0c0c0c, 0xff0d0d0d,
+    0xff0e0e0e, 0xff0d0d0d, 0xff0c0c0c, 0xff0c0c0c, 0xff0c0c0c, 0xff0b0b0b, 0xff090909, 0xff090909,
+    0xff080808, 0xff070707, 0xff090909, 0xff090909, 0xff0b0b0b, 0xff0e0e0e, 0xff101010, 0xff131313,
+    0xff141414, 0xff151515, 0xff151515, 0xff131313, 0xff121212, 0xff111111, 0xff0e0e0e, 0xff0b0b0b,
+    0xff090909, 0xff060606, 0xff050505, 0xff020202, 0xff020202, 0xff010101, 0xff010101, 0xff010101,
+    0xff010101, 0xff030303, 0xff060606, 0xff080808, 0xff0a0a0a, 0xff080808, 0xff080808, 0xff080808,
+    0xff0e0e0e, 0xff222222, 0xff2b2b2b, 0xff2c2c2c, 0xff292929, 0xff131313, 0xd8020202, 0x81000000,
+    0x4e000000, 0x40000000, 0x4d000000, 0x98000000, 0xcd000000, 0x7d000000, 0x1e000000, 0x0b000000,
+    0x05000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000,
+    0x32000000, 0xcb020202, 0xff3b3b3b, 0xff6b6b6b, 0xff6f6f6f, 0xff717171, 0xff6d6d6d, 0xff666666,
+    0xff5a5a5a, 0xff4d4d4d, 0xff2d2d2d, 0xff040404, 0xff070707, 0xff0a0a0a, 0xff060606, 0xff040404,
+    0xff020202, 0xff030303, 0xff030303, 0xff020202, 0xff010101, 0xff020202, 0xff030303, 0xff050505,
+    0xff060606, 0xff080808, 0xff0a0a0a, 0xff0c0c0c, 0xff0d0d0d, 0xff0f0f0f, 0xff101010, 0xff111111,
+    0xff111111, 0xff111111, 0xff111111, 0xff111111, 0xff101010, 0xff0f0f0f, 0xff0e0e0e, 0xff0d0d0d,
+    0xff0c0c0c, 0xff0b0b0b, 0xff0d0d0d, 0xff0e0e0e, 0xff0f0f0f, 0xff121212, 0xff141414, 0xff171717,
+    0xff181818, 0xff1a1a1a, 0xff191919, 0xff171717, 0xff161616, 0xff141414, 0xff121212, 0xff0e0e0e,
+    0xff0c0c0c, 0xff080808, 0xff050505, 0xff030303, 0xff020202, 0xff020202, 0xff010101, 0xff010101,
+    0xff020202, 0xff020202, 0xff030303, 0xff020202, 0xff050405, 0xff090909, 0xff0c0c0c, 0xff0c0c0d,
+    0xff0d0d0d, 0xff0c0c0c, 0xff202020, 0xff2b2b2b, 0xff2d2d2d, 0xff2b2b2b, 0xfe151515, 0xcb000000,
+    0x57000000, 0x35000000, 0x2e000000, 0x36000000, 0x72000000, 0xd1000000, 0x99000000, 0x2d000000,
+    0x0f000000, 0x06000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000,
+    0x07000000, 0x52000000, 0xdf060606, 0xff3f3f3f, 0xff5f5f5f, 0xff606060, 0xff606060, 0xff595959,
+    0xff4f4f4f, 0xff454545, 0xff2a2a2a, 0xff060606, 0xff060606, 0xff090909, 0xff030303, 0xff020202,
+    0xff020202, 0xff020202, 0xff020202, 0xff010101, 0xff020202, 0xff030303, 0xff040404, 0xff060606,
+    0xff080808, 0xff0b0b0b, 0xff0d0d0d, 0xff101010, 0xff111111, 0xff131313, 0xff141414, 0xff151515,
+    0xff161616, 0xff161616, 0xff151515, 0xff141414, 0xff141414, 0xff131313, 0xff121212, 0xff111111,
+    0xff101010, 0xff101010, 0xff111111, 0xff121212, 0xff141414, 0xff171717, 0xff191919, 0xff1b1b1b,
+    0xff1d1d1d, 0xff1e1e1e, 0xff1d1d1d, 0xff1b1b1b, 0xff1a1a1a, 0xff181818, 0xff151515, 0xff121212,
+    0xff0f0f0f, 0xff0b0b0b, 0xff080808, 0xff050505, 0xff030303, 0xff020202, 0xff020202, 0xff030303,
+    0xff040404, 0xff030303, 0xff030303, 0xff040405, 0xff080808, 0xff040405, 0xff000001, 0xff000000,
+    0xff131313, 0xff171717, 0xff0b0b0b, 0xff232323, 0xff2b2b2b, 0xff2d2d2d, 0xff292929, 0xf50a0a0a,
+    0x8b000000, 0x3b000000, 0x24000000, 0x1f000000, 0x28000000, 0x59000000, 0xc4000000, 0xa3000000,
+    0x30000000, 0x13000000, 0x07000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x11000000, 0x76000000, 0xed090909, 0xff393939, 0xff4b4b4b, 0xff4d4d4d, 0xff4b4b4b,
+    0xff444444, 0xff3b3b3b, 0xff282828, 0xff070707, 0xff080808, 0xff060606, 0xff030303, 0xff010101,
+    0xff010101, 0xff010101, 0xff020202, 0xff020202, 0xff030303, 0xff040404, 0xff050505, 0xff080808,
+    0xff0a0a0a, 0xff0e0e0e, 0xff101010, 0xff131313, 0xff151515, 0xff171717, 0xff181818, 0xff181818,
+    0xff181818, 0xff191919, 0xff191919, 0xff181818, 0xff171717, 0xff161616, 0xff161616, 0xff151515,
+    0xff151515, 0xff151515, 0xff161616, 0xff161616, 0xff191919, 0xff1c1c1c, 0xff1d1d1d, 0xff1f1f1f,
+    0xff1f1f1f, 0xff202020, 0xff202020, 0xff1e1e1e, 0xff1d1d1d, 0xff1c1c1c, 0xff181818, 0xff151515,
+    0xff111111, 0xff0d0d0d, 0xff0a0a0a, 0xff060606, 0xff040404, 0xff040404, 0xff040404, 0xff040404,
+    0xff050505, 0xff060606, 0xff070707, 0xff040404, 0xff000000, 0xff080802, 0xff22220a, 0xff191a08,
+    0xff040405, 0xff181818, 0xff1d1d1d, 0xff232323, 0xff282828, 0xff2c2c2c, 0xff2f2f2f, 0xff191919,
+    0xc6000000, 0x57000000, 0x2c000000, 0x15000000, 0x13000000, 0x1e000000, 0x4f000000, 0xc7000000,
+    0xa0000000, 0x33000000, 0x15000000, 0x07000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000, 0x2c000000,
+    0x61000000, 0x86000000, 0xa7000000, 0xdc000000, 0xff060606, 0xff171717, 0xff1c1c1c, 0xff202020,
+    0xff272727, 0xff2b2b2b, 0xff262626, 0xff0c0c0c, 0xff040404, 0xff040404, 0xff020202, 0xff010101,
+    0xff020202, 0xff030303, 0xff020202, 0xff030303, 0xff030303, 0xff050505, 0xff070707, 0xff0a0a0a,
+    0xff0d0d0d, 0xff101010, 0xff131313, 0xff161616, 0xff191919, 0xff171717, 0xff101010, 0xff090909,
+    0xff080808, 0xff0c0c0c, 0xff171717, 0xff1a1a1a, 0xff191919, 0xff191919, 0xff191919, 0xff191919,
+    0xff191919, 0xff1a1a1a, 0xff1a1a1a, 0xff1b1b1b, 0xff1c1c1c, 0xff1f1f1f, 0xff202020, 0xff212121,
+    0xff212121, 0xff212121, 0xff202020, 0xff202020, 0xff1f1f1f, 0xff1d1d1d, 0xff1a1a1a, 0xff181818,
+    0xff131313, 0xff0f0f0f, 0xff0b0b0b, 0xff080808, 0xff060606, 0xff050505, 0xff050505, 0xff060606,
+    0xff070707, 0xff080808, 0xff050506, 0xff000000, 0xff121304, 0xff44460e, 0xff606315, 0xff474913,
+    0xff050501, 0xff070808, 0xff1f1f1f, 0xff212121, 0xff212121, 0xff252525, 0xff2b2b2b, 0xff2b2b2b,
+    0xf1080808, 0x83010101, 0x3c000000, 0x19000000, 0x0a000000, 0x0e000000, 0x1c000000, 0x53000000,
+    0xc7000000, 0x87000000, 0x2a000000, 0x13000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x50000000, 0x9d000000, 0xb3000000,
+    0xa0000000, 0x88000000, 0x76000000, 0x7b000000, 0xaf000000, 0xf0010101, 0xff141414, 0xff1a1a1a,
+    0xff101010, 0xff0c0c0c, 0xff131313, 0xff141414, 0xff040404, 0xff050505, 0xff030303, 0xff040404,
+    0xff050505, 0xff040404, 0xff030303, 0xff040404, 0xff050505, 0xff060606, 0xff080808, 0xff0c0c0c,
+    0xff0f0f0f, 0xff121212, 0xff151515, 0xff171717, 0xff0d0d0d, 0xff0c0c0c, 0xfd2a2a2a, 0xfd464646,
+    0xfe525252, 0xff3b3b3b, 0xfe0b0b0b, 0xff060606, 0xfe080808, 0xff0c0c0c, 0xff171717, 0xff1d1d1d,
+    0xff1d1d1d, 0xff1d1d1d, 0xff1f1f1f, 0xff202020, 0xff212121, 0xff222222, 0xff232323, 0xff222222,
+    0xff222222, 0xff1f1f1f, 0xff202020, 0xff202020, 0xff202020, 0xff1e1e1e, 0xff1c1c1c, 0xff191919,
+    0xff151515, 0xff111111, 0xff0d0d0d, 0xff0a0a0a, 0xff080808, 0xff080808, 0xff090909, 0xff0a0a0a,
+    0xff0b0b0b, 0xff060608, 0xff020202, 0xfe171704, 0xff40420a, 0xff686b10, 0xff7c8016, 0xff787c1b,
+    0xff212209, 0xff000000, 0xff151716, 0xff161616, 0xff0a0a0a, 0xff0c0c0c, 0xff0f0f0f, 0xff222222,
+    0xff191919, 0xbe050505, 0x4f000000, 0x27000000, 0x0b000000, 0x04000000, 0x0b000000, 0x1c000000,
+    0x52000000, 0x67000000, 0x3e000000, 0x21000000, 0x0b000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08000000, 0x83000000, 0x79000000, 0x46000000,
+    0x38000000, 0x3e000000, 0x46000000, 0x50000000, 0x5e000000, 0x90000000, 0xe5050505, 0xff1b1b1b,
+    0xff252525, 0xff1b1b1b, 0xff090909, 0xff0a0a0a, 0xff0f0f0f, 0xff0e0e0e, 0xff0b0b0b, 0xff0a0a0a,
+    0xff080808, 0xff070707, 0xff060606, 0xff050505, 0xff060606, 0xff070707, 0xff090909, 0xff0d0d0d,
+    0xff111111, 0xff131313, 0xff161616, 0xff050505, 0xfe2c2c2c, 0xfe989898, 0xfedcdcdc, 0xfffdfdfd,
+    0xffffffff, 0xfef1f1f1, 0xfdb6b6b6, 0xffa5a5a5, 0xfc8a8a8a, 0xfd3e3e3e, 0xfb0d0d0d, 0xfe0e0e0e,
+    0xff1f1f1f, 0xff212121, 0xff222222, 0xff232323, 0xff242424, 0xff252525, 0xff252525, 0xff222222,
+    0xff141414, 0xff0d0d0d, 0xff080808, 0xff191919, 0xff1f1f1f, 0xff1f1f1f, 0xff1d1d1d, 0xff1b1b1b,
+    0xff171717, 0xff121212, 0xff0f0f0f, 0xff0c0c0c, 0xff0b0b0b, 0xff0b0b0b, 0xff0c0c0c, 0xff0c0c0d,
+    0xff070709, 0xfe0c0d05, 0xfe26270e, 0xff3b3d0f, 0xff585b0b, 0xff777a11, 0xff5e6111, 0xff8d921f,
+    0xfe555717, 0xff000000, 0xff0d0d0d, 0xff1d1d1d, 0xff1c1c1c, 0xff212121, 0xff1e1e1e, 0xff121212,
+    0xff0f0f0f, 0xef070707, 0x74010101, 0x34000000, 0x14000000, 0x04000000, 0x03000000, 0x0b000000,
+    0x1a000000, 0x31000000, 0x38000000, 0x23000000, 0x0c000000, 0x02000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x0b000000, 0x18000000, 0x33000000,
+    0x45000000, 0x47000000, 0x42000000, 0x3c000000, 0x38000000, 0x39000000, 0xa4000000, 0xff090909,
+    0xff212121, 0xff212121, 0xff191919, 0xff0c0c0c, 0xff111111, 0xff111111, 0xff0f0f0f, 0xff0d0d0d,
+    0xff0b0b0b, 0xff090909, 0xff080808, 0xff070707, 0xff080808, 0xff090909, 0xff0b0b0b, 0xff0e0e0e,
+    0xff111111, 0xff151515, 0xff070707, 0xfe2c2c2c, 0xfed2d2d2, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfff7f7f7, 0xfda2a2a2, 0xfc2e2e2e,
+    0xff0b0b0b, 0xff222222, 0xff252525, 0xff272727, 0xff272727, 0xff272727, 0xff232323, 0xfe131313,
+    0xfe454545, 0xff969696, 0xfe6d6d6d, 0xfd212121, 0xfe0f0f0f, 0xff1b1b1b, 0xff1e1e1e, 0xff1b1b1b,
+    0xff181818, 0xff151515, 0xff121212, 0xff101010, 0xff0f0f0f, 0xff0f0f0f, 0xff0f0e0f, 0xff080808,
+    0xff060602, 0xff27290e, 0xff3a3d13, 0xff4b4e0d, 0xff787b12, 0xff888930, 0xff3e3e28, 0xff9a9f40,
+    0xfe8d9126, 0xfe0d0d04, 0xff040406, 0xff1c1d1c, 0xff232323, 0xff292929, 0xff303030, 0xff303030,
+    0xff212121, 0xff060606, 0xcd000000, 0x70000000, 0x28000000, 0x0b000000, 0x03000000, 0x03000000,
+    0x0a000000, 0x17000000, 0x1e000000, 0x15000000, 0x08000000, 0x02000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x08000000, 0x1b000000, 0x2d000000,
+    0x30000000, 0x28000000, 0x1b000000, 0x11000000, 0x14000000, 0x5e000000, 0xd7030303, 0xfe181818,
+    0xff222222, 0xff202020, 0xff1d1d1d, 0xff1a1a1a, 0xff161616, 0xff131313, 0xff121212, 0xff101010,
+    0xff0e0e0e, 0xff0c0c0c, 0xff0a0a0a, 0xff090909, 0xff090909, 0xff090909, 0xff0b0b0b, 0xff0d0d0d,
+    0xff101010, 0xff0d0d0d, 0xff0e0e0e, 0xfeb3b3b3, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfed4d4d4,
+    0xfe3c3c3c, 0xff101010, 0xff272727, 0xff292929, 0xff292929, 0xff292929, 0xff191919, 0xfd383838,
+    0xffdedede, 0xffffffff, 0xffffffff, 0xffcacaca, 0xfd565656, 0xfe131313, 0xff171717, 0xff1d1d1d,
+    0xff1a1a1a, 0xff171717, 0xff141415, 0xff121312, 0xff121212, 0xfe0c0d0f, 0xfd0c0c09, 0xff343613,
+    0xff313111, 0xff121205, 0xff3a3c08, 0xff2f3103, 0xff797b1b, 0xff98995f, 0xff4c4c4d, 0xffbbbe83,
+    0xfeb2b737, 0xfb27280a, 0xfe000004, 0xff181818, 0xff141414, 0xff242424, 0xff2f2f2f, 0xff353535,
+    0xff3c3c3c, 0xff222222, 0xf0010101, 0xd4000000, 0x98000000, 0x2a000000, 0x0c000000, 0x06000000,
+    0x03000000, 0x06000000, 0x08000000, 0x06000000, 0x03000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x04000000, 0x0c000000, 0x12000000,
+    0x0b000000, 0x0b000000, 0x2d000000, 0x66000000, 0x9b000000, 0xe4000000, 0xf9080808, 0xff101010,
+    0xff0f0f0f, 0xff0e0e0e, 0xff101010, 0xff1a1a1a, 0xff1a1a1a, 0xff171717, 0xff151515, 0xff131313,
+    0xff111111, 0xff0e0e0e, 0xff0c0c0c, 0xff0a0a0a, 0xff0a0a0a, 0xff090909, 0xff0a0a0a, 0xff0c0c0c,
+    0xff0f0f0f, 0xff010101, 0xff545454, 0xfffefefe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffd3d3d3, 0xff212121, 0xff181818, 0xff292929, 0xff282828, 0xff292929, 0xff131313, 0xfe6b6b6b,
+    0xffffffff, 0xffe5e5e5, 0xffaaaaaa, 0xffeeeeee, 0xfff7f7f7, 0xfe5f5f5f, 0xff090909, 0xff1e1e1e,
+    0xff1b1b1b, 0xff171717, 0xff151515, 0xff141313, 0xfe0b0b0e, 0xfc0d0e08, 0xfe4d4f1d, 0xff676926,
+    0xff434411, 0xff161701, 0xff3d3f06, 0xff5d600d, 0xff3c3d12, 0xff474835, 0xff575758, 0xffe0e2c3,
+    0xfdccd159, 0xfa4b4c11, 0xfe000002, 0xff171717, 0xff0e0e0e, 0xff0d0d0d, 0xff242424, 0xff353535,
+    0xff3c3c3c, 0xff383838, 0xf40d0d0d, 0xaa010101, 0xcd000000, 0xa4000000, 0x30000000, 0x12000000,
+    0x07000000, 0x02000000, 0x01000000, 0x01000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x00000000,
+    0x32000000, 0x8d000000, 0xaa000000, 0xc1000000, 0xf2040404, 0xfd171717, 0xff1f1f1f, 0xff1d1d1d,
+    0xff1b1b1b, 0xff171717, 0xff161616, 0xff1c1c1c, 0xff1b1b1b, 0xff191919, 0xff171717, 0xff151515,
+    0xff131313, 0xff101010, 0xff0d0d0d, 0xff0c0c0c, 0xff0b0b0b, 0xff090909, 0xff090909, 0xff0a0a0a,
+    0xff0a0a0a, 0xff000000, 0xfd848484, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xff707070, 0xff050505, 0xff262626, 0xff292929, 0xff272727, 0xf90b0b0b, 0xfd838383,
+    0xffffffff, 0xff939393, 0xff040404, 0xff9b9b9b, 0xffffffff, 0xfe575757, 0xff0e0e0e, 0xff1f1f1f,
+    0xff1b1b1b, 0xff181818, 0xfe141415, 0xfc08070a, 0xfc1d1d0c, 0xfe626525, 0xff656926, 0xff38390f,
+    0xff4e510a, 0xff4b4e08, 0xff2e3006, 0xffadb424, 0xffc0c44c, 0xff474736, 0xff1c1d21, 0xff91918b,
+    0xffd4d775, 0xfa6e721c, 0xfd000001, 0xff151615, 0xff212121, 0xff181818, 0xff0b0b0b, 0xff232323,
+    0xff3d3d3d, 0xff424242, 0xff202020, 0xbb000000, 0x88000000, 0xd0000000, 0xa6000000, 0x33000000,
+    0x14000000, 0x06000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11000000, 0x72000000,
+    0xc2000000, 0x82000000, 0x74000000, 0xd6040404, 0xfe1f1f1f, 0xff313131, 0xff2f2f2f, 0xff2d2d2d,
+    0xff2a2a2a, 0xff262626, 0xff222222, 0xff1f1f1f, 0xff1c1c1c, 0xff191919, 0xff181818, 0xff161616,
+    0xff141414, 0xff111111, 0xff0f0f0f, 0xff0c0c0c, 0xff0a0a0a, 0xff080808, 0xff080808, 0xff080808,
+    0xff040404, 0xff0a0a0a, 0xfdbfbfbf, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfffafafa, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfe979797, 0xff050505, 0xff212121, 0xff262626, 0xff232323, 0xfb060606, 0xfc8f8f8f,
+    0xffffffff, 0xffbdbdbd, 0xff4b4b4b, 0xffcecece, 0xfecdcdcd, 0xfe1f1f1f, 0xff191919, 0xff1e1e1e,
+    0xff191a1a, 0xfe141415, 0xfc080908, 0xfd2a2b10, 0xff75792b, 0xff80822c, 0xff393b10, 0xff2c2e05,
+    0xff747711, 0xff9da21c, 0xff545712, 0xff757920, 0xfff8fd65, 0xff848656, 0xff565752, 0xff56564f,
+    0xff5c5d2c, 0xfb5b5e1a, 0xfc050503, 0xff101010, 0xff1c1c1c, 0xff252525, 0xff212121, 0xff0f0f0f,
+    0xff313131, 0xff464646, 0xfb1f1f1f, 0xc0000000, 0x7a000000, 0x7f000000, 0xcf000000, 0x9b000000,
+    0x30000000, 0x14000000, 0x06000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x49000000, 0xa8000000, 0xa4000000,
+    0x4d000000, 0x4b000000, 0xd3020202, 0xff1d1d1d, 0xff313131, 0xff323232, 0xff313131, 0xff303030,
+    0xff2a2a2a, 0xff272727, 0xff1f1f1f, 0xff0e0e0e, 0xff0b0b0b, 0xff0b0b0b, 0xff101010, 0xff151515,
+    0xff131313, 0xff101010, 0xff0e0e0e, 0xff0b0b0b, 0xff0a0a0a, 0xff070707, 0xff070707, 0xff060606,
+    0xff020202, 0xfe0a0a0a, 0xfdbfbfbf, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffcecece, 0xff4b4b4b, 0xff6c6c6c, 0xffeeeeee, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfc8d8d8d, 0xff060606, 0xff212121, 0xff232323, 0xff212121, 0xff0c0c0c, 0xfd3a3a3a,
+    0xfec7c7c6, 0xfceeeeee, 0xfae5e5e5, 0xf9bfbfbf, 0xfd383839, 0xff111111, 0xff1f1f20, 0xff1d1d1c,
+    0xfe100f11, 0xfb080906, 0xfe414318, 0xff7c7f2d, 0xff7f832d, 0xff71742c, 0xff2d2e10, 0xff616414,
+    0xffacb125, 0xffd3d835, 0xffb7bd37, 0xff454718, 0xffd4d94f, 0xff6e7131, 0xffa0a261, 0xffecf178,
+    0xff838727, 0xff131406, 0xff000000, 0xff090909, 0xff0e0e0e, 0xff1a1a1a, 0xff2c2c2c, 0xff1f1f1f,
+    0xff1a1a1a, 0xff3b3b3b, 0xee0c0c0c, 0x9c000000, 0x77000000, 0x5a000000, 0x6c000000, 0xc9000000,
+    0x71000000, 0x29000000, 0x11000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x1c000000, 0x8a000000, 0xbe000000, 0x70000000, 0x33000000,
+    0x3e000000, 0xbb010101, 0xff151515, 0xff2e2e2e, 0xff323232, 0xff333333, 0xff323232, 0xff2f2f2f,
+    0xff2b2b2b, 0xff252525, 0xff0e0e0e, 0xff0a0a0a, 0xff111111, 0xff0c0c0c, 0xff090909, 0xff111111,
+    0xff121212, 0xff101010, 0xff0d0d0d, 0xff0b0b0b, 0xff090909, 0xff070707, 0xff050505, 0xff050505,
+    0xff030303, 0xfe000000, 0xfd8e8e8e, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xff949494, 0xff000000, 0xff0b0b0b, 0xffd0d0d0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xfa696969, 0xff070707, 0xff202020, 0xff1f1f1f, 0xff1e1e1e, 0xff1c1c1c, 0xff0b0b0b,
+    0xfd1b1b1b, 0xfc4d4d4d, 0xfd5f5f5f, 0xfd262626, 0xff0b0b0b, 0xff1d1d1d, 0xff1a1a1a, 0xff0b0b0d,
+    0xfe19190a, 0xfe52551e, 0xff83872c, 0xff878b2c, 0xff959851, 0xff828368, 0xff3b3b2d, 0xffabae4b,
+    0xffdde244, 0xffeef34d, 0xfff1f855, 0xff696c26, 0xff777b2a, 0xff7c7f27, 0xffcad034, 0xffe3ea36,
+    0xff6a6f1f, 0xff090a06, 0xfd0b0c04, 0xfe070608, 0xff0b0b0b, 0xff121212, 0xff212121, 0xff303030,
+    0xff161616, 0xff191919, 0xd2030303, 0x86000000, 0x6c000000, 0x47000000, 0x31000000, 0x5b000000,
+    0x5e000000, 0x3b000000, 0x1e000000, 0x08000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x48000000, 0x8b000000, 0x40000000, 0x30000000, 0x41000000,
+    0x5e000000, 0xe7050505, 0xff242424, 0xff303030, 0xff323232, 0xff343434, 0xff323232, 0xff2f2f2f,
+    0xff2a2a2a, 0xff161616, 0xff090909, 0xff181818, 0xff191919, 0xff161616, 0xff111111, 0xff101010,
+    0xff0f0f0f, 0xff0e0e0e, 0xff0c0c0c, 0xff0b0b0b, 0xff080808, 0xff070707, 0xff060606, 0xff050505,
+    0xff040404, 0xff000000, 0xfe5d5d5d, 0xfffefefe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffdcdcdc, 0xff646464, 0xff858585, 0xfff5f5f5, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfff4f4f4, 0xfe3c3c3c, 0xff0d0d0d, 0xff1e1e1e, 0xff1c1c1c, 0xff1b1b1b, 0xff1b1b1b, 0xff191919,
+    0xff141414, 0xff0b0b0b, 0xff0a0a0a, 0xff161616, 0xff1c1c1c, 0xff121114, 0xff030307, 0xfe000000,
+    0xff454719, 0xff92972a, 0xff7b7f1f, 0xff464825, 0xff5f6051, 0xff51504e, 0xff46463a, 0xffcbcf6f,
+    0xffe8ee59, 0xfff4fb59, 0xffffff5c, 0xffaeb13a, 0xff0c0c07, 0xff575a1d, 0xff828822, 0xff37390e,
+    0xff0f1005, 0xfe646719, 0xfc2d2e0d, 0xff020206, 0xff0e0e0e, 0xff161616, 0xff1e1e1e, 0xff323232,
+    0xff2a2a2a, 0xfd040404, 0xaf000000, 0x7b000000, 0x5e000000, 0x32000000, 0x19000000, 0x1e000000,
+    0x33000000, 0x37000000, 0x21000000, 0x0a000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x01000000, 0x07000000, 0x12000000, 0x2b000000, 0x43000000, 0x3e000000,
+    0x69000000, 0xf0080808, 0xff262626, 0xff2d2d2d, 0xff313131, 0xff333333, 0xff323232, 0xff2f2f2f,
+    0xff262626, 0xff0d0d0d, 0xff181818, 0xff1a1a1a, 0xff131313, 0xff0a0a0a, 0xff0a0a0a, 0xff070807,
+    0xff060606, 0xff080808, 0xff0a0a0a, 0xff0a0a0a, 0xff090909, 0xff080808, 0xff070707, 0xff060606,
+    0xff050505, 0xff000000, 0xfe212121, 0xffe6e6e6, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xfda5a5a5, 0xfd111111, 0xff181818, 0xff1b1b1b, 0xff191919, 0xff181818, 0xff161616, 0xff171716,
+    0xff161616, 0xff171717, 0xff19191a, 0xfe121214, 0xfd050609, 0xfd111208, 0xfe474912, 0xff4e5211,
+    0xff0d0d04, 0xff767a22, 0xffb4b870, 0xff92928f, 0xff7d7d7c, 0xff2a2a28, 0xff353522, 0xff525329,
+    0xff595b24, 0xff6b6e27, 0xffb2b638, 0xffcdd33c, 0xff0f1007, 0xff000000, 0xff000000, 0xff171903,
+    0xff9fa61b, 0xfec9cf2f, 0xfc333510, 0xff010107, 0xff101010, 0xff191919, 0xff222222, 0xff2f2f2f,
+    0xff2c2c2c, 0xfa020202, 0xab000000, 0x72000000, 0x4e000000, 0x22000000, 0x0a000000, 0x0c000000,
+    0x18000000, 0x1f000000, 0x13000000, 0x07000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x01000000, 0x04000000, 0x11000000, 0x26000000, 0x2e000000, 0x1e000000,
+    0x7f000000, 0xfc0f0f0f, 0xff252525, 0xff2b2b2b, 0xff303030, 0xff323232, 0xff313131, 0xff2e2e2e,
+    0xff292929, 0xff232323, 0xff1e1e1e, 0xff191919, 0xff101010, 0xfc010101, 0xfd010101, 0xff000001,
+    0xff020202, 0xff060606, 0xff090909, 0xff090909, 0xff090909, 0xff080808, 0xff080808, 0xff070707,
+    0xff070707, 0xff030303, 0xfe010101, 0xfd9a9a9a, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffe1e1e1,
+    0xfc343434, 0xfe0d0d0d, 0xff191919, 0xff141414, 0xff121212, 0xff121212, 0xff101010, 0xff0e0e0f,
+    0xff0f0e0f, 0xfe0c0b0d, 0xfe070608, 0xfe0f0f07, 0xfe434619, 0xff898c31, 0xffaeb32c, 0xffa7ac1f,
+    0xff2b2c08, 0xff2b2c1b, 0xffc9cab2, 0xfffffffe, 0xffe1e1d6, 0xff515241, 0xffb7bb5d, 0xffd8dd55,
+    0xffaeb338, 0xff898d25, 0xffaaae29, 0xff8c9127, 0xff000001, 0xff050501, 0xff5d610d, 0xffcfd81b,
+    0xffa8af1b, 0xfd818523, 0xfa373912, 0xfe030309, 0xff151515, 0xff1d1d1d, 0xff262626, 0xff313131,
+    0xff1b1b1b, 0xe5000000, 0xc6000000, 0x72000000, 0x44000000, 0x1a000000, 0x05000000, 0x03000000,
+    0x07000000, 0x09000000, 0x06000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x01000000, 0x02000000, 0x08000000, 0x10000000, 0x10000000, 0x0c000000,
+    0x9d000000, 0xff141414, 0xff252525, 0xff2b2b2b, 0xff303030, 0xff323232, 0xff313131, 0xff2e2e2e,
+    0xff292929, 0xff242424, 0xff1e1e1e, 0xff1c1c1c, 0xff100f11, 0xf9181a0a, 0xfa373910, 0xfd050401,
+    0xff000000, 0xff020202, 0xff090908, 0xff0b0c0c, 0xff0d0d0d, 0xff0c0c0c, 0xff0c0c0c, 0xff0b0b0b,
+    0xff0a0a0a, 0xff0b0b0b, 0xff030303, 0xff191919, 0xfe939393, 0xffefefef, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfef6f6f6, 0xfa606060,
+    0xfc090909, 0xff121212, 0xff101110, 0xff0e0f0f, 0xff0f1010, 0xff101110, 0xff0a0a0b, 0xfe070707,
+    0xfd090905, 0xfd181809, 0xfe333513, 0xff6f7427, 0xffabaf3a, 0xff83872a, 0xff7e821d, 0xffcdd230,
+    0xff9a9e2f, 0xff12110d, 0xff444444, 0xffd7d8c6, 0xffb3b495, 0xff595a2d, 0xfff0f75f, 0xffffff4f,
+    0xffffff43, 0xfff3fa39, 0xff8e9323, 0xff131407, 0xff1d1f06, 0xff383b09, 0xffc2c91c, 0xffb7bf23,
+    0xff5f6220, 0xfc757829, 0xfa2c2d0f, 0xfe0a090c, 0xff181818, 0xff212121, 0xff2c2c2c, 0xff2e2e2e,
+    0xf20b0b0b, 0xb0000000, 0xd6000000, 0x86000000, 0x45000000, 0x1c000000, 0x06000000, 0x01000000,
+    0x01000000, 0x02000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x01000000, 0x14000000,
+    0xb9000000, 0xff151515, 0xff242424, 0xff2b2b2b, 0xff2f2f2f, 0xff313131, 0xff313131, 0xff2f2f2f,
+    0xff2c2c2c, 0xff262626, 0xff1c1c1c, 0xff1a1a1b, 0xff151516, 0xfe21220e, 0xff7b7f1f, 0xfa525311,
+    0xf6090901, 0xfd000000, 0xff000001, 0xff050606, 0xff0d0d0e, 0xff111111, 0xff131212, 0xff121112,
+    0xff111111, 0xff111011, 0xff0f0f0f, 0xff0b0b0b, 0xfe161616, 0xfe545453, 0xffa8a8a8, 0xffececec,
+    0xfffefefe, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xfedbdcdc, 0xfd696969, 0xfd050505,
+    0xfe0d0e0d, 0xff101111, 0xff101111, 0xff0c0d0e, 0xff0a0a0b, 0xff060607, 0xff0d0e05, 0xfe2e2f0f,
+    0xfe414412, 0xff545518, 0xff7b8028, 0xffb0b548, 0xff9fa152, 0xff3d3d27, 0xff9c9e59, 0xffe5e95c,
+    0xffe7ec5b, 0xff686939, 0xff030305, 0xff26271d, 0xff393a24, 0xff6a6e29, 0xffe4eb48, 0xffcfd537,
+    0xff909523, 0xff3d3f10, 0xff0e0f06, 0xff717517, 0xffced528, 0xff595c0f, 0xff9a9e3a, 0xff5d5e40,
+    0xff1c1d1a, 0xfc747645, 0xfb19190c, 0xfe101012, 0xff1e1e1e, 0xff272727, 0xff333333, 0xff232323,
+    0xd2020202, 0x89000000, 0xcb000000, 0xac000000, 0x4e000000, 0x25000000, 0x0a000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09000000,
+    0xa9000000, 0xff131313, 0xff222222, 0xff282828, 0xff2d2d2d, 0xff303030, 0xff323232, 0xff2e2e2e,
+    0xff1f1f1f, 0xff111111, 0xff090909, 0xff181919, 0xff1e1e1e, 0xfe10100c, 0xfe73781f, 0xfe94991e,
+    0xf662650f, 0xf6383b08, 0xfe1a1b04, 0xfe030201, 0xfe010104, 0xff0a0a0d, 0xff111012, 0xff141414,
+    0xff161616, 0xff131313, 0xff101111, 0xff101010, 0xff0e0e0e, 0xfe0e0d0d, 0xfe151515, 0xff303030,
+    0xff575757, 0xfd6e6e6e, 0xfd7c7c7c, 0xfd7c7d7d, 0xfe535352, 0xfe1c1c1c, 0xff000000, 0xff0a0a0b,
+    0xff0b0a0c, 0xff06060a, 0xff040407, 0xff0a0a05, 0xff020201, 0xff202008, 0xff565912, 0xff636616,
+    0xff40430d, 0xff292b04, 0xff585924, 0xff898a64, 0xff3e3d38, 0xff908f8a, 0xfff8facd, 0xfff7fb8d,
+    0xfffeff6e, 0xffb7bb51, 0xff0c0c06, 0xff000000, 0xff000000, 0xff111108, 0xff27280f, 0xff1c1c0b,
+    0xff161706, 0xff555813, 0xffafb525, 0xfff3fc33, 0xfffcff38, 0xff7a7e18, 0xff818263, 0xffb9baad,
+    0xff353537, 0xfd50513d, 0xfc0f0f0a, 0xff19191a, 0xff232323, 0xff2d2d2d, 0xff343434, 0xfa131313,
+    0xaa000000, 0x7b000000, 0xa5000000, 0xc8000000, 0x5b000000, 0x31000000, 0x11000000, 0x02000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x86010101, 0xff0d0d0d, 0xff202020, 0xff262626, 0xff2c2c2c, 0xff313131, 0xff2b2b2b, 0xff141414,
+    0xff101010, 0xff1a1a1a, 0xff252525, 0xff282828, 0xff222222, 0xfe0b0b0e, 0xfb464915, 0xffaab026,
+    0xff8e9117, 0xfe5f630d, 0xff757911, 0xfe606410, 0xfe333508, 0xff151505, 0xff050404, 0xff050406,
+    0xff060608, 0xff050409, 0xff050608, 0xff060607, 0xff060607, 0xff080709, 0xff040506, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000003, 0xff030303,
+    0xff0e0f04, 0xff26270a, 0xff3c3e0d, 0xff525513, 0xff2b2d0c, 0xff0c0c04, 0xff555813, 0xff6e7216,
+    0xff76792c, 0xff747560, 0xff5f5f60, 0xff151519, 0xff1c1b1f, 0xff5a595a, 0xff858575, 0xffaeb167,
+    0xffd6db56, 0xffd1d54d, 0xff1b1c0c, 0xff000000, 0xff000000, 0xff000000, 0xff222407, 0xff848817,
+    0xffcbd226, 0xfff5fe32, 0xff939820, 0xffb1b72d, 0xfffeff40, 0xffa8af26, 0xff5d5d4f, 0xff8c8c89,
+    0xff7e8071, 0xfe59593c, 0xff0d0d0b, 0xff212121, 0xff292929, 0xff343434, 0xff2b2b2b, 0xe1050505,
+    0x8e000000, 0x70000000, 0x72000000, 0xcc000000, 0x72000000, 0x39000000, 0x1a000000, 0x06000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5f000000, 0xfc080808, 0xff1e1e1e, 0xff252525, 0xff2c2c2c, 0xff2a2a2a, 0xff101010, 0xff171717,
+    0xff303030, 0xff323232, 0xff2b2b2b, 0xff1c1c1c, 0xff171717, 0xff111113, 0xfd0a0a06, 0xfc81851f,
+    0xffb3b922, 0xff51540e, 0xff393a12, 0xff7a7d31, 0xff959a2a, 0xff8a8f1a, 0xff5d6115, 0xff161706,
+    0xff1b1c07, 0xff1d1f07, 0xff111204, 0xff0a0b03, 0xff040402, 0xff050501, 0xff090902, 0xff0b0b04,
+    0xff090903, 0xff0c0c05, 0xff1f200d, 0xff2a2c12, 0xff3a3c16, 0xff474b17, 0xff585b17, 0xff666b16,
+    0xff6f7318, 0xff6d701c, 0xff6d701c, 0xff75771a, 0xff575a13, 0xff000000, 0xff3a3d12, 0xffa1a72a,
+    0xffc1c569, 0xffe0e0cf, 0xff77787a, 0xff5d5d5b, 0xffcaccb6, 0xffa9ac7e, 0xff7c7e40, 0xff5f6222,
+    0xff575a1b, 0xff696d22, 0xff0d0c07, 0xff000000, 0xff36380b, 0xff808617, 0xffbfc723, 0xfffcff32,
+    0xffffff40, 0xffe6ec4d, 0xff4e511f, 0xffb1b535, 0xfffeff3f, 0xffc3cb2a, 0xfd4b4d25, 0xfd70724f,
+    0xff85874d, 0xff262711, 0xff161618, 0xff282828, 0xff303030, 0xff383838, 0xfe1b1b1b, 0xbe000000,
+    0x7e000000, 0x64000000, 0x41000000, 0xb3000000, 0x99000000, 0x41000000, 0x25000000, 0x0b000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x2f000000, 0xea050505, 0xff1a1a1a, 0xff242424, 0xff252525, 0xff0f0f0f, 0xff191919, 0xff333333,
+    0xff363636, 0xff212121, 0xff0f0f0f, 0xff111111, 0xff161616, 0xff1a1a1a, 0xff030308, 0xfb1f1f08,
+    0xfca2a925, 0xff686c1b, 0xff0b0a0e, 0xff1d1c22, 0xff9b9c74, 0xffb8bd46, 0xffa7ac26, 0xff24250c,
+    0xff585b14, 0xff9ba11b, 0xff656a0f, 0xff6d700e, 0xff848a15, 0xff878c1e, 0xff8a901e, 0xff909618,
+    0xff5e6013, 0xff20210b, 0xff989d2e, 0xffa0a533, 0xff8e912b, 0xffa8ad2c, 0xffb5ba33, 0xffaeb33c,
+    0xff878a37, 0xff333317, 0xff65664a, 0xff979a61, 0xff959941, 0xff232510, 0xff151708, 0xffc1c643,
+    0xffe7ec74, 0xff8f9170, 0xff4d4e3e, 0xffdde19e, 0xffffff9f, 0xffffff77, 0xffe2e954, 0xff929730,
+    0xff363912, 0xff080905, 0xff2d2d0a, 0xff34360b, 0xff4e5211, 0xffd1d925, 0xff626611, 0xff82861e,
+    0xffd7dc62, 0xffc6ca82, 0xff56583f, 0xffe1e570, 0xfff9ff40, 0xffd9e124, 0xfe4d500c, 0xfeabb02b,
+    0xff676a1b, 0xff08080a, 0xff222223, 0xff2e2e2e, 0xff373737, 0xff343434, 0xee090909, 0x9a000000,
+    0x77000000, 0x53000000, 0x29000000, 0x60000000, 0x86000000, 0x46000000, 0x2d000000, 0x10000000,
+    0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x10000000, 0xb5010101, 0xff101010, 0xff212121, 0xff111111, 0xff131313, 0xff303030, 0xff363636,
+    0xff232323, 0xff0e0e0e, 0xff262626, 0xff2e2e2e, 0xff232323, 0xff1f1f1f, 0xff151516, 0xfe000001,
+    0xfc2d2e0d, 0xff63661f, 0xff959761, 0xff4a4a47, 0xff707076, 0xffc7c997, 0xffbec53d, 0xff333511,
+    0xff4e5017, 0xffc2c826, 0xff737913, 0xff414407, 0xff7e8131, 0xff95985a, 0xff7f824c, 0xffc5c960,
+    0xff999d2d, 0xff141508, 0xff959a2c, 0xffa8ad32, 0xff494b16, 0xff41421a, 0xff65673f, 0xff737458,
+    0xff383831, 0xff5e5e5f, 0xffbcbcb8, 0xffcccdc4, 0xffd6d7b4, 0xff6a6c49, 0xff000000, 0xff9a9f3f,
+    0xffebf165, 0xff696b2c, 0xffc7cb58, 0xffffff69, 0xffdce34a, 0xff898d29, 0xff24260d, 0xff1d1f09,
+    0xff515410, 0xff999f19, 0xffe4ec22, 0xffafb61c, 0xff151507, 0xffacb226, 0xffbbc02c, 0xff6c6e31,
+    0xff515240, 0xff464640, 0xff555551, 0xfff0f3ad, 0xfffcff45, 0xffedf720, 0xff5e610e, 0xff727515,
+    0xff1a1b07, 0xff151518, 0xff2b2b2b, 0xff343434, 0xff383838, 0xff1c1c1c, 0xc9000000, 0x83000000,
+    0x6b000000, 0x40000000, 0x1b000000, 0x14000000, 0x2b000000, 0x3d000000, 0x2d000000, 0x11000000,
+    0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x02000000, 0x49000000, 0xe3040404, 0xff0f0f0f, 0xff0c0c0c, 0xff262626, 0xff313131, 0xff262626,
+    0xff0e0e0e, 0xff2a2a2a, 0xff393939, 0xff333333, 0xff252525, 0xff1f1f1f, 0xff1c1c1c, 0xff0a0a0b,
+    0xff020201, 0xff4b4e16, 0xff8c8f3c, 0xfe949661, 0xfea6a78b, 0xffdee092, 0xffe5eb49, 0xff5d5f1d,
+    0xff3d3e16, 0xffd3d935, 0xffc7ce2a, 0xff6b701a, 0xff141414, 0xff090913, 0xff49494f, 0xffcccea9,
+    0xffcdd258, 0xff2b2c0e, 0xff4d501c, 0xffc6cc42, 0xffbfc44a, 0xffa7a87a, 0xff535357, 0xff0e0d14,
+    0xff232327, 0xff59595b, 0xff8b8b8c, 0xffbdbdb7, 0xfff2f3d6, 0xffc9cc87, 0xff101107, 0xff303214,
+    0xffdde257, 0xffe4e955, 0xffc0c542, 0xff707320, 0xff23240a, 0xff111107, 0xff6a6e13, 0xffc1c81c,
+    0xffdae21e, 0xfff8ff23, 0xfff6ff27, 0xffe6ef2c, 0xff34350f, 0xff64681c, 0xffffff47, 0xfffbff95,
+    0xffd3d4c3, 0xff424144, 0xff2f2f30, 0xff5b5d41, 0xff969c22, 0xffe3eb1e, 0xff64670e, 0xff131403,
+    0xff0d0d0e, 0xff252526, 0xff323232, 0xff373737, 0xff1e1e1e, 0xd9020202, 0x92000000, 0x78000000,
+    0x59000000, 0x2c000000, 0x0e000000, 0x0a000000, 0x17000000, 0x24000000, 0x1d000000, 0x0b000000,
+    0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x02000000, 0x0d000000, 0x7f000000, 0xfc010101, 0xff131313, 0xff282828, 0xff2b2b2b, 0xff101010,
+    0xff1f1f1f, 0xff393939, 0xff393939, 0xff343434, 0xff282828, 0xff232323, 0xff212121, 0xff1a1a1a,
+    0xff080808, 0xff020202, 0xff171809, 0xff1f210d, 0xfe3c3d20, 0xff797c2b, 0xffa2a62f, 0xff333413,
+    0xff363714, 0xffbdc338, 0xff767a20, 0xff545617, 0xff8d913e, 0xff969854, 0xff575837, 0xff676944,
+    0xffc5c949, 0xff676925, 0xff050507, 0xff8d913a, 0xffeff55e, 0xffadb069, 0xff48483f, 0xff9b9c7b,
+    0xffd3d5b0, 0xffa2a383, 0xff696b4a, 0xff5e603f, 0xffe2e683, 0xfffcff74, 0xff4c4e1f, 0xff000000,
+    0xff383916, 0xff3f4016, 0xff0b0b04, 0xff0a0a05, 0xff5d6018, 0xffb7bc1e, 0xfff8ff22, 0xff8e9214,
+    0xff8a9016, 0xfff5fe2f, 0xfff0f935, 0xfffaff3b, 0xff838724, 0xff20210d, 0xffd8de3d, 0xffffff88,
+    0xffeef0c8, 0xff5e5f59, 0xffb1b475, 0xffa5ab30, 0xff555809, 0xfe949a15, 0xfe3e4009, 0xff000005,
+    0xff1d1d1e, 0xff2d2d2d, 0xff333333, 0xff1f1f1f, 0xdf030303, 0x96000000, 0x7c000000, 0x67000000,
+    0x40000000, 0x1a000000, 0x06000000, 0x03000000, 0x08000000, 0x0d000000, 0x0b000000, 0x05000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x01000000, 0x01000000, 0x64000000, 0xf0000000, 0xfd0c0c0c, 0xff232323, 0xff1f1f1f, 0xff0e0e0e,
+    0xff2e2e2e, 0xff363636, 0xff393939, 0xff363636, 0xff2a2a2a, 0xff242424, 0xff242424, 0xff202021,
+    0xff171718, 0xff070607, 0xff2b2c10, 0xff868a29, 0xff5c601a, 0xff1e200a, 0xff2b2b19, 0xff0b0b07,
+    0xff0c0c05, 0xff1f200d, 0xff2b2d11, 0xff4e501b, 0xff6a6d29, 0xff6f7231, 0xff757730, 0xff53551c,
+    0xff7b7f29, 0xff6e702c, 0xff030304, 0xff262714, 0xffacb142, 0xff84872f, 0xff9ca140, 0xffe8ed72,
+    0xffe0e579, 0xffdadf78, 0xffc6cb65, 0xff909340, 0xff71742b, 0xff4d4f1d, 0xff0e0e08, 0xff000001,
+    0xff000000, 0xff000000, 0xff0e0e08, 0xff9ea22c, 0xfffbff38, 0xffffff4d, 0xffd3d759, 0xff3f401a,
+    0xffbdc338, 0xfff6fe3e, 0xfff2f940, 0xfff9fe41, 0xffcbd237, 0xff1a1b0a, 0xff9ca12a, 0xffffff4a,
+    0xffbcc150, 0xff555728, 0xffe1e847, 0xffffff30, 0xfcccd51f, 0xf93d4108, 0xfe020103, 0xff121213,
+    0xff272727, 0xff303030, 0xff202020, 0xe8050505, 0x9a010101, 0x7d000000, 0x6c000000, 0x4a000000,
+    0x25000000, 0x0c000000, 0x02000000, 0x01000000, 0x01000000, 0x02000000, 0x02000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x26000000, 0xb5000000, 0x88000000, 0xc7000000, 0xfe111111, 0xff111111, 0xff191919,
+    0xff313131, 0xff343434, 0xff383838, 0xff363636, 0xff2b2b2b, 0xff272727, 0xff272727, 0xff262626,
+    0xff212121, 0xff181818, 0xff070709, 0xff3a3b13, 0xff888f28, 0xff3c3e14, 0xff7a7a6b, 0xff72726d,
+    0xff000000, 0xff000000, 0xff000000, 0xff151608, 0xff1b1b08, 0xff0b0b01, 0xff060603, 0xff131309,
+    0xff0e0f08, 0xff060606, 0xff000001, 0xff000001, 0xff000003, 0xff21210e, 0xff3b3d16, 0xff2d2f10,
+    0xff21230c, 0xff1f200b, 0xff22230c, 0xff26280e, 0xff2f310f, 0xff424515, 0xff484b1b, 0xff45471b,
+    0xff070804, 0xff000100, 0xff313213, 0xff777a1f, 0xff9ca050, 0xffdfdfb9, 0xff777777, 0xff7e7f74,
+    0xffffff8c, 0xfff4fb45, 0xfff2f941, 0xfff4fc3e, 0xfff1f93a, 0xff454714, 0xff575a18, 0xfffaff38,
+    0xffa3a922, 0xff7a7d1d, 0xfffaff3b, 0xffcfd52a, 0xfc40420a, 0xfe000000, 0xff0a090b, 0xff1e1e1e,
+    0xff2a2a2a, 0xff1c1c1c, 0xea060606, 0x9e010101, 0x7e000000, 0x6d000000, 0x4d000000, 0x29000000,
+    0x0f000000, 0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x09000000, 0xa0000000, 0x8f000000, 0x38000000, 0x78000000, 0xdc000000, 0xff040404, 0xff1d1d1d,
+    0xff2d2d2d, 0xff333333, 0xff363636, 0xff343434, 0xff2c2c2c, 0xff2b2b2b, 0xff2b2b2b, 0xff292929,
+    0xff282828, 0xff252525, 0xff1d1d1d, 0xff0a0a0d, 0xff0c0c06, 0xff131305, 0xff2a2a24, 0xff70706c,
+    0xff0f100c, 0xff030304, 0xff3a3d16, 0xff575a18, 0xffb6bc33, 0xffd2d843, 0xffb9be3a, 0xff989d2a,
+    0xff797d1e, 0xff7c8121, 0xff2b2c0e, 0xff1e1f0a, 0xff66691e, 0xff6e7120, 0xfe7b7f23, 0xff828625,
+    0xff8f9428, 0xff9ea32a, 0xffbbc031, 0xffd3da38, 0xffeaf143, 0xfff4fb48, 0xfff2f945, 0xfff0f648,
+    0xff6b6e25, 0xff000000, 0xff414218, 0xffa3a571, 0xff6b6b76, 0xff3f3f45, 0xff16161e, 0xff949590,
+    0xffe9ec84, 0xfff6fe43, 0xfff7ff3d, 0xfff3fc38, 0xfff6fe36, 0xff6f731e, 0xff343510, 0xffecf43b,
+    0xffe6ed3c, 0xfed8df3d, 0xffb4ba32, 0xff2d2f0b, 0xff000000, 0xff060506, 0xff131313, 0xff212121,
+    0xff191919, 0xea050505, 0x9e000000, 0x7f000000, 0x6f000000, 0x4f000000, 0x2b000000, 0x11000000,
+    0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0e000000, 0x63000000, 0x32000000, 0x41000000, 0x51000000, 0x9a000000, 0xe5000000, 0xed060606,
+    0xff161616, 0xff272727, 0xff343434, 0xff343434, 0xff2e2e2e, 0xff2f2f2f, 0xff2e2e2e, 0xff2f2f2f,
+    0xff2d2d2d, 0xff2b2b2b, 0xff282828, 0xff232324, 0xff151517, 0xff0b0b0a, 0xff17180c, 0xff363721,
+    0xff0c0d0a, 0xff202110, 0xffc5cb3a, 0xff919627, 0xff545625, 0xffb4b76e, 0xffadb064, 0xff5e5f2a,
+    0xff93963e, 0xffffff4c, 0xff8f9329, 0xff27280e, 0xffe2e93a, 0xfffaff3f, 0xffbabe30, 0xffd3da37,
+    0xfffdff4c, 0xffffff5b, 0xffffff65, 0xffffff73, 0xffc8cc5f, 0xff878a36, 0xffecf151, 0xfffdff4b,
+    0xffd9df42, 0xff2d2e10, 0xff2e2f10, 0xffeef2a0, 0xfffbfbeb, 0xff5f5f5b, 0xff4c4d38, 0xff5b5d33,
+    0xff50521b, 0xff7b7f1e, 0xffb9c02a, 0xffe4ec31, 0xfff9ff37, 0xff979d2b, 0xff24250e, 0xffd6dc3f,
+    0xfcd1d93e, 0xfa686c21, 0xff131408, 0xff000002, 0xff070708, 0xff0f0f0f, 0xff181818, 0xff141414,
+    0xe9030303, 0xa1000000, 0x7f000000, 0x71000000, 0x52000000, 0x2d000000, 0x12000000, 0x05000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x01000000, 0x07000000, 0x24000000, 0x3b000000, 0x35000000, 0x8a000000, 0xac000000, 0x84000000,
+    0xc8020202, 0xf5080808, 0xff1a1a1a, 0xff2c2c2c, 0xff303030, 0xff333333, 0xff333333, 0xff343434,
+    0xff333333, 0xff303030, 0xff2e2e2e, 0xff2c2c2c, 0xff292929, 0xff212121, 0xff141414, 0xff0e0e09,
+    0xff000000, 0xff545721, 0xffe1e642, 0xffd5db42, 0xff4f5130, 0xff060510, 0xff2a2a30, 0xffa7a7a8,
+    0xffededd8, 0xfffeff79, 0xffb7bd2e, 0xff0d0e07, 0xffb2b72d, 0xfff5fb3d, 0xff828621, 0xff474a13,
+    0xff767936, 0xffc8cb92, 0xfff8f9ca, 0xffadaf8c, 0xff484943, 0xff959686, 0xfff4f97d, 0xfff3fa43,
+    0xfffbff44, 0xff999d2a, 0xff101008, 0xffb5ba41, 0xffbec456, 0xff484a1e, 0xffd9df48, 0xffeaf33e,
+    0xffb6bc27, 0xff797d1a, 0xff505311, 0xff989f23, 0xffffff3f, 0xffbac038, 0xff21220e, 0xfe5b5d20,
+    0xfc24250f, 0xfe000000, 0xff020205, 0xff0b0b0b, 0xff0e0e0e, 0xff101010, 0xff0d0d0d, 0xe8020202,
+    0xa2000000, 0x80000000, 0x72000000, 0x53000000, 0x2f000000, 0x13000000, 0x06000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x02000000, 0x09000000, 0x18000000, 0x21000000, 0x1a000000, 0x91000000, 0x8b000000, 0x56000000,
+    0x72000000, 0x8e000000, 0xc5020202, 0xf60c0c0c, 0xff1a1a1a, 0xff272727, 0xff333333, 0xff393939,
+    0xff383838, 0xff363636, 0xff353535, 0xff333333, 0xff2f2f2f, 0xff2d2d2d, 0xff292929, 0xff1e1e1e,
+    0xff111111, 0xff16170d, 0xff2f3010, 0xff2c2d0c, 0xff5e602a, 0xff989c42, 0xff5a5c2c, 0xff858768,
+    0xfff3f5bd, 0xfffeff76, 0xffd5dd31, 0xff1e200c, 0xff767a1e, 0xfff9ff39, 0xffeff837, 0xffc7cd34,
+    0xff848659, 0xff535357, 0xff404047, 0xff2a2a31, 0xffaeadaa, 0xfffffff0, 0xfffcff82, 0xfff1f937,
+    0xfff5fc3a, 0xffe0e936, 0xff292a0d, 0xff696d1a, 0xff676b0f, 0xff8a9016, 0xfff7ff2d, 0xfff7ff31,
+    0xfffbff38, 0xfff8ff3b, 0xffdae036, 0xffc0c837, 0xffb2b936, 0xfd686c23, 0xfe111107, 0xff000000,
+    0xff000002, 0xff050506, 0xff080808, 0xff090909, 0xfe060606, 0xed030303, 0xcc000000, 0x9e000000,
+    0x81000000, 0x72000000, 0x55000000, 0x31000000, 0x15000000, 0x06000000, 0x01000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x01000000, 0x03000000, 0x08000000, 0x07000000, 0x15000000, 0xa2000000, 0x71000000, 0x4e000000,
+    0x59000000, 0x4d000000, 0x57000000, 0x83010101, 0xb7010101, 0xe3050505, 0xfe121212, 0xff212121,
+    0xff2f2f2f, 0xff393939, 0xff3b3b3b, 0xff393939, 0xff353535, 0xff333333, 0xff313131, 0xff2d2d2d,
+    0xff292929, 0xff202022, 0xff0e0d12, 0xff0c0c0a, 0xff303011, 0xff676924, 0xff7e822d, 0xff3f4211,
+    0xff8e9231, 0xfffaff51, 0xfffcff46, 0xff6e7223, 0xff2c2e0e, 0xffe6ef36, 0xfffaff36, 0xfffbff38,
+    0xffe0e758, 0xff54553c, 0xff363719, 0xff4a4b29, 0xff5f604a, 0xffa3a562, 0xffdfe542, 0xfff3fc34,
+    0xfff1f934, 0xfffaff36, 0xff7f831f, 0xff202209, 0xffacb31d, 0xffedf725, 0xfff3fc2d, 0xffe3ea34,
+    0xffb8be32, 0xff898c29, 0xff676a22, 0xff363614, 0xff0d0e08, 0xfe000003, 0xfe060505, 0xff040304,
+    0xff040404, 0xff050405, 0xff030303, 0xff030303, 0xf7010101, 0xab000000, 0x84000000, 0x7b000000,
+    0x6d000000, 0x52000000, 0x30000000, 0x16000000, 0x06000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x01000000, 0x01000000, 0x00000000, 0x1f000000, 0xaf000000, 0x59000000, 0x48000000,
+    0x41000000, 0x2b000000, 0x2a000000, 0x39000000, 0x50000000, 0x6c000000, 0x9a010101, 0xce040404,
+    0xf50b0b0b, 0xff171717, 0xff282828, 0xff343434, 0xff3a3a3a, 0xff3a3a3a, 0xff383838, 0xff333333,
+    0xff313131, 0xff2d2d2d, 0xff282828, 0xff212122, 0xff151517, 0xff100f0e, 0xff0e0d08, 0xff1c1d0b,
+    0xff363811, 0xff646720, 0xff959932, 0xff898c2b, 0xff0d0e07, 0xff7b8026, 0xffe9f140, 0xffedf444,
+    0xff777b1f, 0xff757923, 0xffeef552, 0xffebf24e, 0xffa7ac2f, 0xff616519, 0xff575a17, 0xffabb031,
+    0xfff6fe44, 0xfffaff40, 0xffbcc330, 0xff161709, 0xff767b18, 0xff929a1f, 0xff646918, 0xff3d3f13,
+    0xff131308, 0xff000001, 0xff000002, 0xff000003, 0xff030305, 0xff040405, 0xff030303, 0xff020202,
+    0xff020202, 0xff040404, 0xff090909, 0xff101010, 0xfd090909, 0xb9000000, 0x7a000000, 0x67000000,
+    0x49000000, 0x2b000000, 0x14000000, 0x06000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x33000000, 0xb1000000, 0x47000000, 0x47000000,
+    0x33000000, 0x16000000, 0x0e000000, 0x17000000, 0x27000000, 0x38000000, 0x47000000, 0x5d000000,
+    0x80010101, 0xb3050505, 0xda060606, 0xf60d0d0d, 0xff1e1e1e, 0xff2d2d2d, 0xff363636, 0xff393939,
+    0xff373737, 0xff323232, 0xff2e2e2e, 0xff292929, 0xff232324, 0xff1b1a1c, 0xff131314, 0xff0b0c0d,
+    0xff030407, 0xff000001, 0xff040401, 0xff0c0b04, 0xff030201, 0xff0b0b06, 0xff444719, 0xff5f6222,
+    0xff56581e, 0xff727428, 0xfe848730, 0xfe80842f, 0xff82862e, 0xff7a7d2c, 0xff4d501d, 0xff4b4d1d,
+    0xff73762a, 0xff626421, 0xff3f4013, 0xff0c0c04, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff030305, 0xff080809, 0xff090808, 0xff040404, 0xff010101, 0xff000000, 0xff010101, 0xff030303,
+    0xff070707, 0xff0d0d0d, 0xff111111, 0xff161616, 0xff111112, 0xdb020202, 0x7b000000, 0x52000000,
+    0x2b000000, 0x11000000, 0x05000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x59000000, 0xaa000000, 0x42000000, 0x47000000,
+    0x2b000000, 0x0e000000, 0x03000000, 0x04000000, 0x0b000000, 0x14000000, 0x21000000, 0x2f000000,
+    0x3e000000, 0x4f000000, 0x67000000, 0x8c010101, 0xbe040404, 0xe5080808, 0xfb121212, 0xff1e1e1e,
+    0xff202020, 0xff282828, 0xff292929, 0xff272727, 0xff222222, 0xff1d1d1d, 0xff181818, 0xff111111,
+    0xff0d0c0d, 0xff080708, 0xff040305, 0xff010001, 0xff020101, 0xff000000, 0xff000000, 0xff000000,
+    0xff010101, 0xff010101, 0xfe000002, 0xfe000001, 0xff000001, 0xff010101, 0xff080705, 0xff070604,
+    0xff000002, 0xff000002, 0xff000002, 0xff020202, 0xff020203, 0xff010102, 0xff030304, 0xff060607,
+    0xff070707, 0xff050505, 0xff010201, 0xff000000, 0xff000000, 0xff010101, 0xff030303, 0xff070707,
+    0xff0c0c0c, 0xff101010, 0xff161616, 0xff1b1b1b, 0xff1f2020, 0xf4070707, 0x8d000000, 0x4c000000,
+    0x23000000, 0x08000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x66000000, 0x87000000, 0x41000000, 0x44000000,
+    0x24000000, 0x0a000000, 0x01000000, 0x00000000, 0x02000000, 0x03000000, 0x07000000, 0x0e000000,
+    0x18000000, 0x26000000, 0x35000000, 0x44000000, 0x56000000, 0x70000000, 0x93000000, 0xd5000000,
+    0xff070707, 0xff121212, 0xff101010, 0xff0d0d0d, 0xff0b0b0b, 0xff0a0a0a, 0xff080808, 0xff070707,
+    0xff050505, 0xff030303, 0xff010101, 0xff000001, 0xff010101, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000001, 0xff010001, 0xff010001, 0xff000000, 0xff000001,
+    0xff010101, 0xff040404, 0xff050506, 0xff050505, 0xff030403, 0xff010201, 0xff020202, 0xff010101,
+    0xff000000, 0xff000000, 0xff010101, 0xff010101, 0xff020202, 0xff030303, 0xff050505, 0xff090909,
+    0xff0e0e0e, 0xff141414, 0xff1b1b1b, 0xff242524, 0xff2c2d2d, 0xfd141414, 0xb4010101, 0x56000000,
+    0x2a000000, 0x0b000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x1a000000, 0x30000000, 0x3f000000, 0x3b000000,
+    0x1c000000, 0x07000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000,
+    0x05000000, 0x0a000000, 0x12000000, 0x1d000000, 0x2a000000, 0x38000000, 0x48000000, 0xc0040404,
+    0xff222222, 0xff363636, 0xff2f2f2f, 0xff272727, 0xff1e1e1e, 0xff151515, 0xff0e0e0e, 0xff0a0a0a,
+    0xff070707, 0xff040404, 0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff000000, 0xff010101,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff010101, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff010101, 0xff010101, 0xff010101, 0xff030303, 0xff050505, 0xff090909,
+    0xff10100f, 0xff191919, 0xff242324, 0xff2e2e2e, 0xff353635, 0xff252525, 0xd1030303, 0x66000000,
+    0x38000000, 0x13000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000, 0x19000000, 0x2f000000, 0x29000000,
+    0x12000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x01000000, 0x03000000, 0x07000000, 0x0c000000, 0x11000000, 0x33000000, 0xde0a0a0a,
+    0xff2e2f2e, 0xff3b3b3b, 0xff343434, 0xff2d2d2d, 0xff252525, 0xff1d1d1d, 0xff151515, 0xff0f0f0f,
+    0xff080808, 0xff050505, 0xff030303, 0xff020302, 0xff010101, 0xff010101, 0xff010100, 0xff010101,
+    0xff010101, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff010101, 0xff010101, 0xff030302, 0xff070707, 0xff0c0b0c,
+    0xff141414, 0xff212021, 0xff2c2c2c, 0xff343333, 0xff3b3b3b, 0xff2d2d2d, 0xdb030303, 0x76000000,
+    0x45000000, 0x1b000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04000000, 0x0e000000, 0x17000000, 0x13000000,
+    0x08000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x3b000000, 0xf1101010,
+    0xff393a39, 0xff3a3a3a, 0xff343434, 0xff2d2d2e, 0xff262526, 0xff1f1f1e, 0xff161717, 0xff0f0f10,
+    0xff0a0a0a, 0xff080807, 0xff070706, 0xff060606, 0xff050505, 0xff050605, 0xff050505, 0xff040505,
+    0xff030504, 0xff030303, 0xff020303, 0xff020302, 0xff020301, 0xff010101, 0xff010000, 0xff000000,
+    0xff000000, 0xff000000, 0xff010100, 0xff010000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff010001, 0xff020202, 0xff040304, 0xff040404, 0xff060604, 0xff080807, 0xff0d0d0c, 0xff131313,
+    0xff1b1b1b, 0xff252424, 0xff2d2d2d, 0xff343434, 0xff3c3c3c, 0xff333333, 0xe8080708, 0x89000000,
+    0x4e000000, 0x22000000, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x04000000, 0x06000000, 0x05000000,
+    0x02000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x69010101, 0xfe1c1c1c,
+    0xff414141, 0xff3f3f3f, 0xff3a3a3a, 0xff343334, 0xff2d2c2d, 0xff262726, 0xff202020, 0xff191818,
+    0xff141413, 0xff111211, 0xff10100f, 0xff0e0f0e, 0xff0e0e0e, 0xff0e0e0e, 0xff0d0d0d, 0xff0c0d0c,
+    0xff0b0d0b, 0xff0a0b0a, 0xff090a0a, 0xff090909, 0xff080908, 0xff070606, 0xff050505, 0xff040303,
+    0xff040403, 0xff050505, 0xff060606, 0xff060606, 0xff050505, 0xff030303, 0xff020302, 0xff040403,
+    0xff050505, 0xff090908, 0xff0c0a0a, 0xff0b0b0b, 0xff0b0c0c, 0xff0d0d0d, 0xff111111, 0xff161616,
+    0xff1b1b1b, 0xff222222, 0xff2b2b2b, 0xff323232, 0xff3a3a3a, 0xff3c3c3c, 0xfb161616, 0xa5000000,
+    0x57000000, 0x2a000000, 0x0b000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x01000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8e010101, 0xff292929,
+    0xff434343, 0xff414141, 0xff3c3c3c, 0xff373737, 0xff2f2f2f, 0xff292929, 0xff232222, 0xff1d1e1e,
+    0xff191a19, 0xff171717, 0xff151515, 0xff151415, 0xff151415, 0xff141414, 0xff141415, 0xff131413,
+    0xff131312, 0xff121212, 0xff111111, 0xff111010, 0xff101010, 0xff0e0e0f, 0xff0d0d0d, 0xff0b0b0c,
+    0xff0b0c0c, 0xff0d0e0c, 0xff0f0f0f, 0xff0e0e0e, 0xff0d0d0d, 0xff0b0c0b, 0xff0a0b0a, 0xff0b0b0a,
+    0xff0d0d0c, 0xff0e0e0d, 0xff0f0e0f, 0xff0e0e0f, 0xff0e0f0e, 0xff0e0e0d, 0xff101010, 0xff131313,
+    0xff181818, 0xff1e1e1e, 0xff272727, 0xff2f2f2f, 0xff373737, 0xff404040, 0xff272727, 0xc9010101,
+    0x64000000, 0x34000000, 0x10000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07000000, 0xa8030303, 0xff303030,
+    0xff454545, 0xff414141, 0xff3c3c3c, 0xff343434, 0xff2c2d2d, 0xff252525, 0xff201f1f, 0xff1a1a1a,
+    0xff171818, 0xff161616, 0xff151515, 0xff151515, 0xff151515, 0xff151515, 0xff151515, 0xff151515,
+    0xff141415, 0xff141414, 0xff141414, 0xff141413, 0xff131413, 0xff131312, 0xff121212, 0xff111111,
+    0xff101211, 0xff111211, 0xff121212, 0xff111111, 0xff101111, 0xff101010, 0xff0f0f0f, 0xff0e0e0d,
+    0xff0e0e0e, 0xff0e0e0e, 0xff0d0d0e, 0xff0c0c0c, 0xff0b0b0b, 0xff0b0b0b, 0xff0c0c0c, 0xff0e0e0e,
+    0xff131313, 0xff191919, 0xff222222, 0xff2d2d2d, 0xff353535, 0xff3f3f3f, 0xff373737, 0xe2060606,
+    0x7b000000, 0x40000000, 0x19000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13000000, 0xc1060606, 0xff333333,
+    0xff444444, 0xff3f3f3f, 0xff393939, 0xff303030, 0xff282828, 0xff202020, 0xff191a1a, 0xff141414,
+    0xff131314, 0xff111111, 0xff111111, 0xff111111, 0xff121212, 0xff131313, 0xff131313, 0xff131213,
+    0xff121213, 0xff121212, 0xff131313, 0xff131311, 0xff121311, 0xff121211, 0xff111111, 0xff101110,
+    0xff111110, 0xff111110, 0xff111010, 0xff0f0f0f, 0xff0e0e0e, 0xff0e0e0e, 0xff0d0e0e, 0xff0c0c0c,
+    0xff0c0c0b, 0xff0a0a0a, 0xff09090a, 0xff080808, 0xff080708, 0xff080808, 0xff080808, 0xff0a0a0a,
+    0xff0f0f0f, 0xff161616, 0xff1d1e1e, 0xff282929, 0xff323232, 0xff3d3d3d, 0xff3d3d3d, 0xee0e0e0e,
+    0x91000000, 0x4d000000, 0x24000000, 0x09000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21000000, 0xd90b0b0b, 0xff373737,
+    0xff444444, 0xff3e3d3e, 0xff363636, 0xff2d2d2d, 0xff232323, 0xff1b1b1b, 0xff151515, 0xff111111,
+    0xff0e0e0e, 0xff0d0d0d, 0xff0e0e0e, 0xff0e0e0e, 0xff0e0e0e, 0xff0e0e0e, 0xff0f0f0f, 0xff0f0f0f,
+    0xff0f0f0f, 0xff0f0f0f, 0xff0f0f0f, 0xff0e0e0e, 0xff0e0f0e, 0xff0e0e0e, 0xff0e0e0e, 0xff0d0d0d,
+    0xff0d0d0d, 0xff0d0d0d, 0xff0c0c0c, 0xff0b0b0b, 0xff0a0a0a, 0xff0a0a0a, 0xff0a0909, 0xff080909,
+    0xff080808, 0xff070707, 0xff060606, 0xff060606, 0xff050505, 0xff050505, 0xff060605, 0xff060707,
+    0xff0c0c0c, 0xff131313, 0xff1a1a19, 0xff252525, 0xff2f2f2f, 0xff3b3b3b, 0xff414141, 0xf6171717,
+    0xa0000000, 0x59000000, 0x2c000000, 0x04000000, 0x04000000, 0x3d000000, 0x59000000, 0x52000000,
+    0x4b000000, 0x39000000, 0x14000000, 0x02000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2e010101, 0xee111111, 0xff3a3a3a,
+    0xff424242, 0xff3c3c3c, 0xff343434, 0xff2a2a2a, 0xff202020, 0xff171717, 0xff0f1010, 0xff0d0d0d,
+    0xff0b0a0b, 0xff0a0a0a, 0xff0a0a0a, 0xff0a0a0b, 0xff0a0a0a, 0xff0a0a0b, 0xff0b0b0b, 0xff0b0b0b,
+    0xff0b0b0b, 0xff0b0b0b, 0xff0a0a0a, 0xff0a0a0a, 0xff0a0a0a, 0xff0a0a0a, 0xff090909, 0xff090909,
+    0xff090909, 0xff080808, 0xff070808, 0xff070707, 0xff070707, 0xff070707, 0xff060606, 0xff050505,
+    0xff050405, 0xff050505, 0xff040404, 0xff030303, 0xff030303, 0xff030403, 0xff030303, 0xff060606,
+    0xff090909, 0xff0f0f0f, 0xff161616, 0xff212121, 0xff2d2d2d, 0xff383838, 0xff454545, 0xfe232323,
+    0xaf000000, 0x5f000000, 0x32000000, 0x42010101, 0xa6030303, 0xed161616, 0xfa2c2c2c, 0xf7282828,
+    0xf4242424, 0xe9191919, 0xca0b0b0b, 0x91020202, 0x54000000, 0x21000000, 0x03000000, 0x03000000,
+    0x02000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3c010101, 0xf6141414, 0xff3f3f3f,
+    0xff404040, 0xff3a3a3a, 0xff313131, 0xff262626, 0xff1d1c1c, 0xff141414, 0xff0c0d0c, 0xff080908,
+    0xff070808, 0xff070707, 0xff080808, 0xff080808, 0xff080808, 0xff080808, 0xff080808, 0xff080808,
+    0xff080808, 0xff080808, 0xff070707, 0xff070707, 0xff070707, 0xff070707, 0xff060606, 0xff060606,
+    0xff060606, 0xff050505, 0xff050505, 0xff040404, 0xff040404, 0xff040404, 0xff030303, 0xff030304,
+    0xff030303, 0xff040404, 0xff040404, 0xff030303, 0xff020302, 0xff020201, 0xff020202, 0xff030303,
+    0xff070707, 0xff0c0c0c, 0xff131313, 0xff1d1d1d, 0xff292929, 0xff353535, 0xff444444, 0xff2e2e2e,
+    0xd10b0b0b, 0x66010101, 0x7d020202, 0xe8131313, 0xff404040, 0xff6a6a6a, 0xff787878, 0xff797979,
+    0xff797979, 0xff767676, 0xff636363, 0xff444444, 0xfc272727, 0xca0d0d0d, 0x53040404, 0x0f000000,
+    0x09000000, 0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6e030303, 0xfe1c1c1c, 0xff424242,
+    0xff3f3f3f, 0xff383838, 0xff2f2f2f, 0xff242424, 0xff191a1a, 0xff111111, 0xff0b0a0b, 0xff070707,
+    0xff050505, 0xff050405, 0xff060606, 0xff070707, 0xff080808, 0xff080707, 0xff070707, 0xff070707,
+    0xff060606, 0xff060606, 0xff060504, 0xff050505, 0xff050404, 0xff040404, 0xff040404, 0xff030303,
+    0xff030303, 0xff040404, 0xff030303, 0xff020302, 0xff030202, 0xff030202, 0xff030303, 0xff030303,
+    0xff030303, 0xff040303, 0xff040403, 0xff030303, 0xff020202, 0xff020202, 0xff020202, 0xff030303,
+    0xff060606, 0xff0a0a0a, 0xff101010, 0xff1a1a1a, 0xff262626, 0xff343434, 0xff434343, 0xff353535,
+    0xe6141414, 0x9b070707, 0xec101010, 0xff525252, 0xff797979, 0xff7e7e7e, 0xff848484, 0xff888888,
+    0xff8a8a8a, 0xff8c8c8c, 0xff8c8c8c, 0xff888888, 0xff7c7c7c, 0xff454545, 0xea111111, 0x74040404,
+    0x1f000000, 0x0d000000, 0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0xa9050505, 0xff2b2b2b, 0xff424242,
+    0xff3f3f3f, 0xff383838, 0xff2e2e2e, 0xff232323, 0xff171717, 0xff0f0f0f, 0xff090909, 0xff050505,
+    0xff050505, 0xff050505, 0xff060505, 0xff070707, 0xff080808, 0xff090808, 0xff070707, 0xff070707,
+    0xff060606, 0xff050505, 0xff040404, 0xff040404, 0xff040303, 0xff020202, 0xff020202, 0xff020202,
+    0xff020202, 0xff010202, 0xff020101, 0xff010201, 0xff020102, 0xff020101, 0xff020202, 0xff030303,
+    0xff040404, 0xff040404, 0xff040404, 0xff040404, 0xff030403, 0xff030303, 0xff030303, 0xff040404,
+    0xff040405, 0xff080808, 0xff0e0e0e, 0xff181818, 0xff232323, 0xff2f2f2f, 0xff404040, 0xff3f3f3f,
+    0xef131313, 0xe60d0d0d, 0xff434343, 0xff757575, 0xff7b7b7b, 0xff818181, 0xff868686, 0xff8b8b8b,
+    0xff8d8d8d, 0xff8f8f8f, 0xff909090, 0xff8e8e8e, 0xff8d8d8d, 0xff848484, 0xff575757, 0xf6181818,
+    0x84040404, 0x24000000, 0x10000000, 0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x22000000, 0xd7090909, 0xff373737, 0xff434343,
+    0xff3e3e3e, 0xff363636, 0xff2c2c2c, 0xff202020, 0xff161616, 0xff0e0e0e, 0xff090909, 0xff050505,
+    0xff040404, 0xff050505, 0xff070707, 0xff090808, 0xff0a0a0a, 0xff0a0a0a, 0xff090909, 0xff090909,
+    0xff070707, 0xff050505, 0xff040303, 0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101,
+    0xff010101, 0xff010101, 0xff010101, 0xff010201, 0xff020202, 0xff030303, 0xff040404, 0xff040404,
+    0xff060505, 0xff060606, 0xff070707, 0xff060606, 0xff050505, 0xff040404, 0xff030303, 0xff040404,
+    0xff050505, 0xff080808, 0xff0d0d0d, 0xff151515, 0xff202020, 0xff2c2c2c, 0xff3a3a3a, 0xff424242,
+    0xfb141414, 0xfe191919, 0xff606060, 0xff747474, 0xff7d7d7d, 0xff828282, 0xff868686, 0xff8a8a8a,
+    0xff8d8d8d, 0xff8f8f8f, 0xff919191, 0xff919191, 0xff8e8e8e, 0xff8b8b8b, 0xff878787, 0xff545454,
+    0xea0e0e0e, 0x5e030303, 0x25000000, 0x0e000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x52000000, 0xfa161616, 0xff3f3f3f, 0xff414141,
+    0xff3d3d3d, 0xff353535, 0xff2a2a2a, 0xff1f1f1f, 0xff151515, 0xff0c0d0c, 0xff080908, 0xff060606,
+    0xff050505, 0xff070707, 0xff090909, 0xff0b0b0b, 0xff0c0c0c, 0xff0d0d0d, 0xff0c0c0c, 0xff0a0b0b,
+    0xff080909, 0xff070606, 0xff050404, 0xff030303, 0xff020202, 0xff020201, 0xff010101, 0xff010101,
+    0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff030303, 0xff030303, 0xff050505, 0xff060606,
+    0xff080808, 0xff090909, 0xff090909, 0xff090909, 0xff080808, 0xff060606, 0xff050505, 0xff050505,
+    0xff040404, 0xff070707, 0xff0b0b0b, 0xff121212, 0xff1c1c1c, 0xff282828, 0xff353535, 0xff3f3f3f,
+    0xfe141414, 0xfe0e0e0e, 0xff2e2e2e, 0xff3b3b3b, 0xff535353, 0xff676767, 0xff7c7c7c, 0xff848484,
+    0xff878787, 0xff8a8a8a, 0xff8d8d8d, 0xff8e8e8e, 0xff8e8e8e, 0xff8c8c8c, 0xff878787, 0xff757575,
+    0xff272727, 0xa1090909, 0x40000000, 0x1e000000, 0x08000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x97020202, 0xff252525, 0xff434343, 0xff414141,
+    0xff3c3c3c, 0xff333333, 0xff282828, 0xff1e1e1e, 0xff131313, 0xff0d0d0d, 0xff080808, 0xff060606,
+    0xff060606, 0xff080808, 0xff0a0b0a, 0xff0d0d0d, 0xff0f0f0f, 0xff101010, 0xff0f0f0f, 0xff0c0c0d,
+    0xff0a0a0a, 0xff080808, 0xff060505, 0xff030303, 0xff020202, 0xff020202, 0xff010101, 0xff010100,
+    0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff040404, 0xff050404, 0xff070607, 0xff090909,
+    0xff0b0b0b, 0xff0c0c0c, 0xff0c0c0c, 0xff0b0b0b, 0xff0a0a0a, 0xff080808, 0xff060606, 0xff050505,
+    0xff040404, 0xff050505, 0xff090909, 0xff0f0f0f, 0xff181818, 0xff242424, 0xff2f2f2f, 0xff3c3c3c,
+    0xff1f1f1f, 0xd5010101, 0xbd090909, 0xcc0c0c0c, 0xd90a0a0a, 0xef121212, 0xff3b3b3b, 0xff747474,
+    0xff7f7f7f, 0xff818181, 0xff858585, 0xff888888, 0xff8a8a8a, 0xff898989, 0xff858585, 0xff808080,
+    0xff424242, 0xcc090909, 0x5d000000, 0x30000000, 0x0f000000, 0x02000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x11000000, 0xce060606, 0xff333333, 0xff434343, 0xff414141,
+    0xff3c3c3c, 0xff333333, 0xff272727, 0xff1c1c1c, 0xff121212, 0xff0b0b0b, 0xff070707, 0xff060606,
+    0xff070707, 0xff090909, 0xff0c0c0c, 0xff0f0f0f, 0xff111111, 0xff121212, 0xff111111, 0xff101010,
+    0xff0d0d0d, 0xff0a0a0a, 0xff070707, 0xff040404, 0xff030303, 0xff020202, 0xff010101, 0xff000101,
+    0xff010001, 0xff010101, 0xff020202, 0xff030303, 0xff050505, 0xff060707, 0xff0a090a, 0xff0c0c0c,
+    0xff0e0e0e, 0xff101010, 0xff0f0f0f, 0xff0e0e0e, 0xff0c0d0d, 0xff0a0a0a, 0xff070707, 0xff050505,
+    0xff040404, 0xff040404, 0xff070707, 0xff0c0c0c, 0xff151515, 0xff1d1d1d, 0xff292929, 0xff383838,
+    0xff272727, 0xc0000000, 0x7f000000, 0x7b000000, 0x79000000, 0x8e000000, 0xdb040404, 0xff404040,
+    0xff717171, 0xff757575, 0xff7a7a7a, 0xff7f7f7f, 0xff828282, 0xff838383, 0xff828282, 0xff7e7e7e,
+    0xff5d5d5d, 0xe30b0b0b, 0x71000000, 0x3f000000, 0x18000000, 0x04000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x43000000, 0xee0f0f0f, 0xff3c3c3c, 0xff424242, 0xff414141,
+    0xff3b3b3b, 0xff313131, 0xff262626, 0xff1b1b1b, 0xff121212, 0xff0b0b0b, 0xff070707, 0xff060606,
+    0xff070707, 0xff0a0a0a, 0xff0d0d0d, 0xff101010, 0xff131313, 0xff141414, 0xff141414, 0xff121212,
+    0xff0f0f0f, 0xff0b0b0b, 0xff070807, 0xff050505, 0xff040404, 0xff020202, 0xff010101, 0xff010101,
+    0xff010101, 0xff020202, 0xff030303, 0xff040504, 0xff070607, 0xff090909, 0xff0c0c0c, 0xff0f0f0f,
+    0xff111111, 0xff121212, 0xff121212, 0xff101010, 0xff0e0e0e, 0xff0b0b0b, 0xff080808, 0xff060606,
+    0xff030303, 0xff040404, 0xff060606, 0xff0a0a0a, 0xff101010, 0xff181818, 0xff212121, 0xff303030,
+    0xff282828, 0xdb050505, 0x85000000, 0x6c000000, 0x59000000, 0x51000000, 0x84010101, 0xf2101010,
+    0xff4e4e4e, 0xff666666, 0xff6d6d6d, 0xff737373, 0xff777777, 0xff7b7b7b, 0xff7b7b7b, 0xff7a7a7a,
+    0xff636363, 0xe50d0d0d, 0x7b000000, 0x4c000000, 0x20000000, 0x07000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x6e000000, 0xff1d1d1d, 0xff404040, 0xff424242, 0xff404040,
+    0xff393939, 0xff303030, 0xff252525, 0xff191919, 0xff101010, 0xff0a0a0a, 0xff070707, 0xff050505,
+    0xff060606, 0xff0a0a0a, 0xff0d0d0d, 0xff111111, 0xff141414, 0xff161616, 0xff161616, 0xff141414,
+    0xff111111, 0xff0e0e0e, 0xff090909, 0xff070707, 0xff040404, 0xff020202, 0xff010101, 0xff010101,
+    0xff020202, 0xff030303, 0xff040404, 0xff060606, 0xff090909, 0xff0b0b0b, 0xff0e0e0e, 0xff111111,
+    0xff141414, 0xff151515, 0xff141414, 0xff121212, 0xff100f0f, 0xff0c0c0c, 0xff090909, 0xff060606,
+    0xff040404, 0xff030303, 0xff040404, 0xff080808, 0xff0d0d0d, 0xff141414, 0xff1c1c1c, 0xff282828,
+    0xff292929, 0xef0a0a0a, 0x8c000000, 0x62000000, 0x3f000000, 0x2d000000, 0x3a010101, 0xc0070707,
+    0xff2d2d2d, 0xff575757, 0xff5c5c5c, 0xff646464, 0xff6b6b6b, 0xff707070, 0xff727272, 0xff737373,
+    0xff5d5d5d, 0xe70e0e0e, 0x82010101, 0x54000000, 0x27000000, 0x09000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x01000000, 0x89000000, 0xff232323, 0xff434343, 0xff424242, 0xff3f3f3f,
+    0xff393939, 0xff2f2f2f, 0xff242424, 0xff181818, 0xff0f0f0f, 0xff0a0a0a, 0xff050505, 0xff050505,
+    0xff070606, 0xff0a0a0a, 0xff0e0d0e, 0xff111111, 0xff141414, 0xff161616, 0xff171717, 0xff151616,
+    0xff131313, 0xff0f100f, 0xff0b0b0b, 0xff080807, 0xff050505, 0xff030404, 0xff020202, 0xff020202,
+    0xff020202, 0xff040303, 0xff040405, 0xff070808, 0xff0a0a0a, 0xff0e0e0e, 0xff111111, 0xff131314,
+    0xff161616, 0xff161616, 0xff151515, 0xff131313, 0xff0f0f0f, 0xff0c0c0c, 0xff080808, 0xff060606,
+    0xff030303, 0xff030303, 0xff030303, 0xff060606, 0xff0a0a0a, 0xff0f0f0f, 0xff171717, 0xff1f1f1f,
+    0xff272727, 0xf70d0d0d, 0x9d000000, 0x63000000, 0x38000000, 0x19000000, 0x13000000, 0x80010101,
+    0xfc1a1a1a, 0xff464646, 0xff4d4d4d, 0xff555555, 0xff5c5c5c, 0xff646464, 0xff666666, 0xff696969,
+    0xff585858, 0xeb111111, 0x87030303, 0x58000000, 0x2a000000, 0x0a000000, 0x01000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x06000000, 0xaa010101, 0xff292929, 0xff424242, 0xff424242, 0xff3f3f3f,
+    0xff363636, 0xff2d2d2d, 0xff222222, 0xff171717, 0xff0e0e0e, 0xff080808, 0xff060606, 0xff050505,
+    0xff060606, 0xff090909, 0xff0d0d0d, 0xff111111, 0xff151414, 0xff171717, 0xff181818, 0xff161717,
+    0xff141514, 0xff101110, 0xff0c0c0c, 0xff090809, 0xff060606, 0xff040404, 0xff030303, 0xff020202,
+    0xff030303, 0xff040505, 0xff070707, 0xff0a0a0a, 0xff0d0e0d, 0xff101010, 0xff141414, 0xff161617,
+    0xff171717, 0xff171717, 0xff161616, 0xff121313, 0xff100f10, 0xff0c0c0c, 0xff080808, 0xff050606,
+    0xff030303, 0xff010101, 0xff030303, 0xff040404, 0xff080808, 0xff0c0c0c, 0xff131313, 0xff1a1a1a,
+    0xff232323, 0xfe131313, 0xb9000000, 0x69000000, 0x3f000000, 0x17000000, 0x04000000, 0x6f000000,
+    0xfa151515, 0xff393939, 0xff3f3f3f, 0xff464646, 0xff4f4f4f, 0xff575757, 0xff5b5b5b, 0xff5f5f5f,
+    0xff4e4e4e, 0xe70e0e0e, 0x85020202, 0x59000000, 0x2a000000, 0x0b000000, 0x01000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0e000000, 0xc8040404, 0xff2f2f2f, 0xff434343, 0xff414141, 0xff3d3d3d,
+    0xff353535, 0xff2a2a2a, 0xff1f1f1f, 0xff141414, 0xff0d0d0d, 0xff070707, 0xff040404, 0xff040404,
+    0xff050505, 0xff080908, 0xff0c0c0c, 0xff101010, 0xff131415, 0xff171717, 0xff181818, 0xff181818,
+    0xff151515, 0xff121212, 0xff0e0e0e, 0xff0a0a0a, 0xff070708, 0xff070606, 0xff050505, 0xff050505,
+    0xff050605, 0xff080808, 0xff0a0b0b, 0xff0d0d0d, 0xff111111, 0xff131313, 0xff171717, 0xff191919,
+    0xff191919, 0xff181818, 0xff131313, 0xff100f0f, 0xff0e0f0f, 0xff0a0b0b, 0xff070707, 0xff050505,
+    0xff030203, 0xff020202, 0xff020202, 0xff030303, 0xff040404, 0xff090909, 0xff0f0f0f, 0xff161616,
+    0xff202020, 0xff191919, 0xcf000000, 0x74000000, 0x4b000000, 0x1c000000, 0x09000000, 0x9d010101,
+    0xff1e1e1e, 0xff313131, 0xff353535, 0xff3a3a3a, 0xff424242, 0xff4a4a4a, 0xff505050, 0xff575757,
+    0xff3d3d3d, 0xda050505, 0x81000000, 0x59000000, 0x2a000000, 0x0b000000, 0x01000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x15000000, 0xdb070707, 0xff373737, 0xff434343, 0xff414141, 0xff3c3c3c,
+    0xff343434, 0xff282828, 0xff1d1d1d, 0xff131313, 0xff0c0c0c, 0xff060606, 0xff040404, 0xff040404,
+    0xff050505, 0xff070707, 0xff090808, 0xff090a0a, 0xff131313, 0xff161616, 0xff181818, 0xff181818,
+    0xff161617, 0xff151515, 0xff111111, 0xff0d0d0d, 0xff0c0b0a, 0xff090808, 0xff070707, 0xff070707,
+    0xff080908, 0xff0b0a0b, 0xff0e0e0e, 0xff111111, 0xff151515, 0xff181818, 0xff191919, 0xff1b1b1b,
+    0xff1a1a1a, 0xff181919, 0xff0b0b0b, 0xff0a0909, 0xff0f1010, 0xff0a0a0a, 0xff070707, 0xff040404,
+    0xff020202, 0xff020102, 0xff010101, 0xff020202, 0xff030303, 0xff080808, 0xff0b0b0b, 0xff121212,
+    0xff1a1a1a, 0xff191919, 0xe2030303, 0x85000000, 0x56000000, 0x21000000, 0x30000000, 0xd5060606,
+    0xff242424, 0xff2a2a2a, 0xff2c2c2c, 0xff313131, 0xff373737, 0xff3e3e3e, 0xff464646, 0xff4e4e4e,
+    0xff303030, 0xd0040404, 0x7c000000, 0x56000000, 0x27000000, 0x09000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x27000000, 0xe60a0a0a, 0xff3b3b3b, 0xff424242, 0xff404040, 0xff3a3a3a,
+    0xff313131, 0xff252525, 0xff1a1a1a, 0xff121212, 0xff090909, 0xff040404, 0xff020202, 0xff030303,
+    0xff030304, 0xff060606, 0xff080808, 0xff040404, 0xff0f0f0f, 0xff161616, 0xff181818, 0xff191819,
+    0xff181818, 0xff161617, 0xff131314, 0xff111110, 0xff0e0e0e, 0xff0c0b0b, 0xff0b0b0b, 0xff0b0b0b,
+    0xff0e0e0e, 0xff101010, 0xff131313, 0xff171717, 0xff1a1a1a, 0xff1c1c1c, 0xff1c1c1c, 0xff1d1d1d,
+    0xff1b1b1b, 0xff191919, 0xff090909, 0xff0a0a0a, 0xff0e0e0e, 0xff090909, 0xff060606, 0xff040404,
+    0xff020202, 0xff010101, 0xff010101, 0xff020202, 0xff030303, 0xff060606, 0xff090909, 0xff0f0f0f,
+    0xff171717, 0xff1b1b1b, 0xf7090909, 0x99010101, 0x5e000000, 0x2d000000, 0x81000000, 0xf7111111,
+    0xff282828, 0xff252525, 0xff252525, 0xff282828, 0xff2f2f2f, 0xff353535, 0xff3c3c3c, 0xff434343,
+    0xff262626, 0xca060606, 0x78000000, 0x51000000, 0x23000000, 0x08000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x45000000, 0xee0e0e0e, 0xff3d3d3d, 0xff414141, 0xff3d3d3d, 0xff383838,
+    0xff2e2e2e, 0xff232323, 0xff181818, 0xff101010, 0xff080808, 0xff040404, 0xff030303, 0xff020202,
+    0xff030303, 0xff050606, 0xff0a0909, 0xff050505, 0xff090909, 0xff151515, 0xff171616, 0xff191818,
+    0xff191919, 0xff181818, 0xff161717, 0xff141414, 0xff121212, 0xff111111, 0xff101010, 0xff111111,
+    0xff141414, 0xff171717, 0xff191919, 0xff1c1c1c, 0xff1f1f1f, 0xff201f20, 0xff1f2020, 0xff1f1f1f,
+    0xff1d1d1d, 0xff171717, 0xff060606, 0xff0e0e0e, 0xff0e0f0e, 0xff0a0a0a, 0xff060606, 0xff040404,
+    0xff020303, 0xff010101, 0xff010101, 0xff020202, 0xff030303, 0xff050505, 0xff080808, 0xff0d0d0d,
+    0xff141414, 0xff1a1a1a, 0xff0c0c0c, 0xae030303, 0x5f000000, 0x5c000000, 0xd6040404, 0xff212121,
+    0xff252525, 0xff222222, 0xff212121, 0xff222222, 0xff272727, 0xff2e2e2e, 0xff343434, 0xff3c3c3c,
+    0xff1e1e1e, 0xbb030303, 0x73000000, 0x4c000000, 0x1f000000, 0x06000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x5f010101, 0xf9151515, 0xff3e3e3e, 0xff3f3f3f, 0xff3b3b3b, 0xff353535,
+    0xff2b2b2b, 0xff202020, 0xff161616, 0xff0e0e0e, 0xff080808, 0xff030303, 0xff010101, 0xff010101,
+    0xff030302, 0xff050505, 0xff080809, 0xff080808, 0xff040404, 0xff0e0e0e, 0xff141414, 0xff161616,
+    0xff191818, 0xff1a1b1a, 0xff1a1a1a, 0xff181818, 0xff171817, 0xff171717, 0xff171717, 0xff191818,
+    0xff1b1b1b, 0xff1e1e1e, 0xff212121, 0xff222222, 0xff242424, 0xff242424, 0xff222322, 0xff212121,
+    0xff1f201f, 0xff0f0f0f, 0xff080808, 0xff131313, 0xff0e0e0e, 0xff0b0b0b, 0xff070707, 0xff050505,
+    0xff030303, 0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff040404, 0xff070707, 0xff0c0c0c,
+    0xff111111, 0xff191919, 0xff0f0f0f, 0xc3020202, 0x6c000000, 0xba000000, 0xfe161616, 0xff292929,
+    0xff252525, 0xff212121, 0xff1f1f1f, 0xff1f1f1f, 0xff222222, 0xff272727, 0xff2c2c2c, 0xff2f2f2f,
+    0xfe131313, 0xa9010101, 0x6e000000, 0x47000000, 0x1b000000, 0x05000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x7d030303, 0xff1c1c1c, 0xff3d3d3d, 0xff3e3e3e, 0xff393939, 0xff323232,
+    0xff292929, 0xff1d1d1d, 0xff141414, 0xff0c0c0c, 0xff060606, 0xff030303, 0xff010101, 0xff010101,
+    0xff020202, 0xff040404, 0xff060606, 0xff090909, 0xff050505, 0xff040404, 0xff0b0b0b, 0xff111111,
+    0xff161515, 0xff1a1a1a, 0xff1d1d1d, 0xff1e1e1e, 0xff1d1e1e, 0xff1e1e1e, 0xff1e1e1e, 0xff222121,
+    0xff242424, 0xff262626, 0xff282828, 0xff2a2a2a, 0xff2a2a2a, 0xff272727, 0xff242524, 0xff222323,
+    0xff151615, 0xff080808, 0xff121212, 0xff141414, 0xff0f0f0f, 0xff0c0c0c, 0xff080808, 0xff060606,
+    0xff030303, 0xff020202, 0xff010101, 0xff020202, 0xff020202, 0xff040404, 0xff060606, 0xff0b0b0b,
+    0xff101010, 0xff161616, 0xff141414, 0xd9030303, 0xb0000000, 0xf60c0c0c, 0xff282828, 0xff292929,
+    0xff262626, 0xff222222, 0xff1f1f1f, 0xff1e1e1e, 0xff1e1e1e, 0xff212121, 0xff262626, 0xff222222,
+    0xf30a0a0a, 0x97020202, 0x6b000000, 0x3f000000, 0x16000000, 0x04000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x96070707, 0xff212121, 0xff3c3c3c, 0xff3b3b3b, 0xff363636, 0xff2e2e2e,
+    0xff242424, 0xff1a1a1a, 0xff111111, 0xff0b0b0b, 0xff060606, 0xff030303, 0xff010101, 0xff010101,
+    0xff020101, 0xff030303, 0xff050505, 0xff070706, 0xff070706, 0xff030303, 0xff020202, 0xff080808,
+    0xff111111, 0xff171717, 0xff1f1f1f, 0xff232323, 0xff242424, 0xff252525, 0xff272727, 0xff2a2a2a,
+    0xff2c2c2c, 0xff2d2d2d, 0xff2e2e2e, 0xff2f2f2f, 0xff2c2c2c, 0xff292929, 0xff242525, 0xff161717,
+    0xff070808, 0xff131313, 0xff191919, 0xff141414, 0xff101010, 0xff0c0c0c, 0xff090909, 0xff060606,
+    0xff040404, 0xff020202, 0xff010101, 0xff020202, 0xff010101, 0xff030303, 0xff050505, 0xff090909,
+    0xff0e0e0e, 0xff141414, 0xff191919, 0xf6060606, 0xf5060606, 0xff222222, 0xff2b2b2b, 0xff282828,
+    0xff262626, 0xff222222, 0xff1f1f1f, 0xff1c1c1c, 0xff1b1b1b, 0xff1d1d1d, 0xff212121, 0xff161616,
+    0xda060606, 0x84010101, 0x64000000, 0x36000000, 0x11000000, 0x02000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x03000000, 0xa7050505, 0xff242424, 0xff3a3a3a, 0xff373737, 0xff323232, 0xff292929,
+    0xff212121, 0xff181818, 0xff0f0f0f, 0xff090909, 0xff050505, 0xff020202, 0xff020202, 0xff010101,
+    0xff020202, 0xff020302, 0xff040404, 0xff050505, 0xff040404, 0xff030403, 0xff020202, 0xff010101,
+    0xff070808, 0xff131313, 0xff1d1d1d, 0xff242424, 0xff292929, 0xff2c2c2c, 0xff2f2f2f, 0xff323131,
+    0xff343333, 0xff343434, 0xff353435, 0xff313131, 0xff2c2c2c, 0xff282828, 0xff171919, 0xff070808,
+    0xff131314, 0xff1b1b1b, 0xff181818, 0xff141414, 0xff101010, 0xff0d0d0d, 0xff090a0a, 0xff060606,
+    0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff030303, 0xff040404, 0xff080808,
+    0xff0e0e0e, 0xff131313, 0xff1a1a1a, 0xfe161616, 0xff1d1d1d, 0xff282828, 0xff2a2a2a, 0xff282828,
+    0xff252525, 0xff222222, 0xff1f1f1f, 0xff1c1c1c, 0xff1b1b1b, 0xff1b1b1b, 0xff1d1d1d, 0xfd0b0b0b,
+    0xb2010101, 0x7a000000, 0x5a000000, 0x2b000000, 0x0c000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x0c000000, 0xb3030303, 0xff262626, 0xff373737, 0xff333333, 0xff2e2e2e, 0xff262626,
+    0xff1d1d1d, 0xff151515, 0xff0e0e0e, 0xff090909, 0xff050505, 0xff030303, 0xff020202, 0xff020202,
+    0xff020202, 0xff030303, 0xff040504, 0xff050505, 0xff030404, 0xff020303, 0xff030404, 0xff040404,
+    0xff030203, 0xff070808, 0xff161616, 0xff242424, 0xff2b2b2b, 0xff313131, 0xff353535, 0xff383838,
+    0xff393938, 0xff383838, 0xff363635, 0xff303030, 0xff2a2a2a, 0xff1d1d1d, 0xff080808, 0xff121313,
+    0xff1a1a1a, 0xff181818, 0xff171717, 0xff151515, 0xff101010, 0xff0c0c0c, 0xff080909, 0xff060606,
+    0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff030303, 0xff050505, 0xff070707,
+    0xff0b0b0b, 0xff111111, 0xff181818, 0xff1e1e1e, 0xff232323, 0xff262626, 0xff282828, 0xff282828,
+    0xff262626, 0xff222222, 0xff202020, 0xff1d1d1d, 0xff1c1c1c, 0xff1c1c1c, 0xff131313, 0xea040404,
+    0x92000000, 0x72000000, 0x4c000000, 0x1f000000, 0x07000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x17000000, 0xc5040404, 0xff272727, 0xff343434, 0xff2f2f2f, 0xff292929, 0xff232323,
+    0xff1a1a1a, 0xff121212, 0xff0c0c0c, 0xff070707, 0xff050505, 0xff040404, 0xff030303, 0xff040404,
+    0xff020202, 0xff030403, 0xff040505, 0xff050505, 0xff050505, 0xff040405, 0xff040404, 0xff050505,
+    0xff070708, 0xff050506, 0xff060606, 0xff171717, 0xff2b2b2b, 0xff333333, 0xff393939, 0xff3c3c3c,
+    0xff3b3b3b, 0xff383939, 0xff333433, 0xff2d2e2d, 0xff1e1e1e, 0xff090909, 0xff101010, 0xff1a1a1a,
+    0xff181818, 0xff171717, 0xff161615, 0xff141313, 0xff0f0f0f, 0xff0c0c0c, 0xff080808, 0xff060606,
+    0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff030303, 0xff030303, 0xff060606,
+    0xff0b0b0b, 0xff111111, 0xff161616, 0xff1b1b1b, 0xff212121, 0xff252525, 0xff272727, 0xff282828,
+    0xff272727, 0xff242424, 0xff222222, 0xff1f1f1f, 0xff1d1d1d, 0xff191919, 0xfc070707, 0xb7010101,
+    0x7f000000, 0x66000000, 0x39000000, 0x13000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x21000000, 0xde090909, 0xff292929, 0xff303030, 0xff2b2b2b, 0xff262626, 0xff1f1f1f,
+    0xff171717, 0xff101010, 0xff0b0b0b, 0xff070707, 0xff050505, 0xff060606, 0xff050505, 0xff050505,
+    0xff030303, 0xff020202, 0xff040504, 0xff050605, 0xff060606, 0xff080708, 0xff070707, 0xff070707,
+    0xff090909, 0xff0d0d0d, 0xff0c0c0c, 0xff070707, 0xff181818, 0xff313030, 0xff383838, 0xff3a3a3a,
+    0xff393839, 0xff353535, 0xff2f2f2f, 0xff1c1c1c, 0xff090909, 0xff101010, 0xff1a1a1a, 0xff171717,
+    0xff151515, 0xff151515, 0xff131313, 0xff101010, 0xff0c0c0c, 0xff090909, 0xff060606, 0xff050505,
+    0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff040404, 0xff060606,
+    0xff090909, 0xff0f0f0f, 0xff151515, 0xff1a1a1a, 0xff202020, 0xff242424, 0xff262626, 0xff272727,
+    0xff282828, 0xff262626, 0xff242424, 0xff212121, 0xff1f1f1f, 0xff0e0e0e, 0xce020202, 0x87010101,
+    0x75000000, 0x52000000, 0x26000000, 0x0a000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x32010101, 0xf00b0b0b, 0xff2a2a2a, 0xff2d2d2d, 0xff282828, 0xff242424, 0xff1d1d1d,
+    0xff161616, 0xff0f0f0f, 0xff0b0b0b, 0xff080808, 0xff070707, 0xff080808, 0xff070707, 0xff070707,
+    0xff050404, 0xff020202, 0xff050505, 0xff050505, 0xff060606, 0xff090909, 0xff0a0a0a, 0xff0a0a0a,
+    0xff0a0a0a, 0xff0c0c0c, 0xff121212, 0xff111212, 0xff080809, 0xff242424, 0xff323333, 0xff343434,
+    0xff333233, 0xff2f2e2f, 0xff212021, 0xff080808, 0xff111111, 0xff181818, 0xff151515, 0xff121212,
+    0xff121212, 0xff121212, 0xff0f0f0f, 0xff0c0c0c, 0xff0a0a0a, 0xff080808, 0xff020202, 0xff020202,
+    0xff030303, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff030303, 0xff060606,
+    0xff090909, 0xff0d0d0d, 0xff131313, 0xff191919, 0xff1d1d1d, 0xff222222, 0xff252525, 0xff282828,
+    0xff282828, 0xff272727, 0xff262626, 0xff252525, 0xff181818, 0xeb040404, 0x95010101, 0x7a000000,
+    0x62000000, 0x39000000, 0x15000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x5b020202, 0xfc101010, 0xff2b2b2b, 0xff292929, 0xff252525, 0xff202020, 0xff1a1a1a,
+    0xff151515, 0xff0f0f0f, 0xff0c0c0c, 0xff0b0b0b, 0xff0a0a0a, 0xff0a0a0a, 0xff0a0a0a, 0xff0a0a0a,
+    0xff070707, 0xff020202, 0xff060606, 0xff060605, 0xff060606, 0xff080808, 0xff0a0a0a, 0xff0c0c0c,
+    0xff0d0d0d, 0xff0e0e0e, 0xff0f100f, 0xff131515, 0xff0b0c0b, 0xff121313, 0xff282a2a, 0xff2b2a2b,
+    0xff292829, 0xff232223, 0xff0e0e0e, 0xff090909, 0xff141414, 0xff111111, 0xff101010, 0xff0f0f0f,
+    0xff0f0f0f, 0xff0d0d0d, 0xff0b0b0b, 0xff090909, 0xff070707, 0xff050505, 0xff010101, 0xff030303,
+    0xff020202, 0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff020202, 0xff050505,
+    0xff090909, 0xff0d0d0d, 0xff121212, 0xff181818, 0xff1c1c1c, 0xff202020, 0xff242424, 0xff282828,
+    0xff282828, 0xff282828, 0xff2a2a2a, 0xff242424, 0xf80a0a0a, 0xaf020202, 0x7f000000, 0x6c000000,
+    0x47000000, 0x20000000, 0x09000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x8b010101, 0xff171717, 0xff292929, 0xff262626, 0xff232323, 0xff1e1e1e, 0xff191919,
+    0xff131313, 0xff101010, 0xff0d0d0d, 0xff0f0f0f, 0xff0d0d0d, 0xff0d0d0d, 0xff0e0e0e, 0xff0d0d0d,
+    0xff090909, 0xff030303, 0xff070707, 0xff060606, 0xff060605, 0xff070707, 0xff090909, 0xff0d0c0c,
+    0xff0f0f0f, 0xff0f0f10, 0xff0e0f0f, 0xff111111, 0xff0e0f0f, 0xff080707, 0xff191a1a, 0xff201f20,
+    0xff1d1c1d, 0xff111011, 0xff050505, 0xff0e0e0e, 0xff0e0e0e, 0xff0d0d0d, 0xff0d0d0d, 0xff0d0d0d,
+    0xff0b0b0b, 0xff0a0a0a, 0xff080808, 0xff070707, 0xff060606, 0xff020202, 0xff010101, 0xff030303,
+    0xff020202, 0xff010101, 0xff010101, 0xff010101, 0xff020202, 0xff020202, 0xff030303, 0xff050505,
+    0xff070707, 0xff0c0c0c, 0xff101010, 0xff161616, 0xff1b1b1b, 0xff202020, 0xff242424, 0xff272727,
+    0xff292929, 0xff2c2c2c, 0xff2d2d2d, 0xff131313, 0xc9010101, 0x85000000, 0x74000000, 0x53000000,
+    0x2b000000, 0x0f000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x10000000, 0xbb030303, 0xff1e1e1e, 0xff282828, 0xff242424, 0xff212121, 0xff1c1c1c, 0xff181818,
+    0xff141414, 0xff111111, 0xff101010, 0xff101010, 0xff111111, 0xff111111, 0xff101010, 0xff101010,
+    0xff090a09, 0xff050405, 0xff080809, 0xff060606, 0xff060605, 0xff060606, 0xff080808, 0xff0b0b0b,
+    0xff0e0e0e, 0xff101010, 0xff0f0f10, 0xff0e0f0f, 0xff0e0e0f, 0xff060607, 0xff0b0b0b, 0xff141414,
+    0xff0d0d0d, 0xff030403, 0xff090909, 0xff0c0c0c, 0xff0a0a0a, 0xff0b0b0b, 0xff0b0a0b, 0xff090909,
+    0xff070707, 0xff060606, 0xff060606, 0xff050505, 0xff040404, 0xff020202, 0xff010101, 0xff020202,
+    0xff020202, 0xff030303, 0xff020202, 0xff030303, 0xff020202, 0xff030303, 0xff040404, 0xff050505,
+    0xff070707, 0xff0b0b0b, 0xff0f0f0f, 0xff141414, 0xff1a1a1a, 0xff202020, 0xff252525, 0xff282828,
+    0xff2c2c2c, 0xff2e2e2e, 0xff1d1d1d, 0xeb060606, 0x97010101, 0x7a000000, 0x5f000000, 0x36000000,
+    0x15000000, 0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x32000000, 0xe7090909, 0xff222222, 0xff262626, 0xff242424, 0xff212121, 0xff1c1c1c, 0xff191919,
+    0xff161616, 0xff141414, 0xff131313, 0xff131313, 0xff131313, 0xff151515, 0xff151515, 0xff121212,
+    0xff080808, 0xff070707, 0xff0a0909, 0xff060607, 0xff050505, 0xff060606, 0xff070707, 0xff0a0a0a,
+    0xff0c0c0b, 0xff0f0f0f, 0xff111111, 0xff0e0e0f, 0xff0c0c0c, 0xff080707, 0xff030303, 0xff060606,
+    0xff020202, 0xff060606, 0xff090909, 0xff080808, 0xff0a0a0a, 0xff080808, 0xff070707, 0xff070707,
+    0xff050505, 0xff040404, 0xff040404, 0xff040404, 0xff030303, 0xff020202, 0xff010101, 0xff020202,
+    0xff030303, 0xff040404, 0xff040404, 0xff040404, 0xff040404, 0xff040404, 0xff040404, 0xff050505,
+    0xff070707, 0xff0a0a0a, 0xff0f0f0f, 0xff141414, 0xff1a1a1a, 0xff202020, 0xff252525, 0xff292929,
+    0xff2d2d2d, 0xff1d1d1d, 0xf40a0a0a, 0xac050505, 0x80000000, 0x6c000000, 0x44000000, 0x1e000000,
+    0x08000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x63000000, 0xfa101010, 0xff262626, 0xff252525, 0xff232323, 0xff212121, 0xff1e1e1e, 0xff1b1b1b,
+    0xff171717, 0xff151515, 0xff151515, 0xff161616, 0xff161616, 0xff161616, 0xff171717, 0xff121212,
+    0xff060606, 0xff0a0a0a, 0xff0c0b0b, 0xff080808, 0xff060606, 0xff060707, 0xff060606, 0xff080808,
+    0xff0b0b0b, 0xff0d0d0d, 0xff100f0f, 0xff0e0e0e, 0xff0a0a0a, 0xff070606, 0xff010101, 0xff020202,
+    0xff040404, 0xff060606, 0xff070707, 0xff090909, 0xff090909, 0xff080808, 0xff060506, 0xff030404,
+    0xff040404, 0xff040404, 0xff030303, 0xff020202, 0xff030303, 0xff030303, 0xff020202, 0xff020202,
+    0xff050505, 0xff060606, 0xff060606, 0xff060606, 0xff060606, 0xff060606, 0xff060606, 0xff050505,
+    0xff070707, 0xff090909, 0xff0e0e0e, 0xff141414, 0xff1a1a1a, 0xff202020, 0xff262626, 0xff2b2b2b,
+    0xff1e1e1e, 0xec060606, 0xaa040404, 0x83010101, 0x73000000, 0x52000000, 0x2a000000, 0x0d000000,
+    0x03000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000,
+    0xab030303, 0xff181818, 0xff252525, 0xff252525, 0xff242424, 0xff222222, 0xff1f1f1f, 0xff1d1d1d,
+    0xff1a1a1a, 0xff191919, 0xff191919, 0xff191919, 0xff1a1a1a, 0xff191919, 0xff171717, 0xff0f0f0f,
+    0xff060606, 0xff0e0e0e, 0xff0c0c0c, 0xff090909, 0xff070707, 0xff070707, 0xff070707, 0xff080808,
+    0xff090909, 0xff0b0b0b, 0xff0d0d0d, 0xff0c0d0c, 0xff0b0b0b, 0xff060605, 0xff010101, 0xff020202,
+    0xff040404, 0xff050505, 0xff070707, 0xff070707, 0xff070707, 0xff060606, 0xff050505, 0xff040404,
+    0xff040404, 0xff040403, 0xff040404, 0xff040404, 0xff030303, 0xff040404, 0xff030303, 0xff020202,
+    0xff060606, 0xff080808, 0xff090909, 0xff090909, 0xff080808, 0xff080808, 0xff070707, 0xff070707,
+    0xff090909, 0xff0a0a0a, 0xff0f0f0f, 0xff151515, 0xff1a1a1a, 0xff212121, 0xff292929, 0xff222222,
+    0xf2070707, 0xa5010101, 0x7f000000, 0x74000000, 0x58000000, 0x34000000, 0x14000000, 0x04000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21000000,
+    0xde070707, 0xff202020, 0xff252525, 0xff252525, 0xff262626, 0xff252525, 0xff232323, 0xff212121,
+    0xff1e1e1e, 0xff1d1d1d, 0xff1c1c1c, 0xff1d1d1d, 0xff1c1c1c, 0xff1b1b1b, 0xff1a1a1a, 0xff0b0b0b,
+    0xff0a0a0a, 0xff101010, 0xff0d0d0d, 0xff0b0b0b, 0xff090909, 0xff080708, 0xff080808, 0xff090909,
+    0xff090909, 0xff0a0a0a, 0xff0b0b0b, 0xff0c0c0c, 0xff090a0a, 0xff060606, 0xff020201, 0xff010101,
+    0xff040403, 0xff060606, 0xff080808, 0xff070707, 0xff060606, 0xff060606, 0xff070707, 0xff080808,
+    0xff070707, 0xff060606, 0xff060606, 0xff060606, 0xff050605, 0xff070707, 0xff060606, 0xff030303,
+    0xff070707, 0xff0c0c0c, 0xff0c0c0c, 0xff0d0d0d, 0xff0c0c0c, 0xff0b0b0b, 0xff090909, 0xff0a0a0a,
+    0xff0a0a0a, 0xff0c0c0c, 0xff111111, 0xff171717, 0xff1d1d1d, 0xff232323, 0xff272727, 0xfb0f0f0f,
+    0xb6010101, 0x80000000, 0x74000000, 0x56000000, 0x34000000, 0x18000000, 0x07000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4b000000,
+    0xfb0d0d0d, 0xff242424, 0xff282828, 0xff282828, 0xff282828, 0xff282828, 0xff262626, 0xff252525,
+    0xff232323, 0xff212121, 0xff212121, 0xff202020, 0xff202020, 0xff1e1e1e, 0xff1b1b1b, 0xff090909,
+    0xff0f0f0f, 0xff121212, 0xff101010, 0xff0e0e0e, 0xff0c0c0c, 0xff0b0b0b, 0xff0a0b0b, 0xff0b0b0b,
+    0xff0c0c0b, 0xff0a0b0b, 0xff0b0b0b, 0xff0a0b0a, 0xff0a0a0a, 0xff070707, 0xff030302, 0xff030303,
+    0xff060606, 0xff070707, 0xff070707, 0xff080808, 0xff090808, 0xff080808, 0xff0a0a0a, 0xff0b0b0b,
+    0xff0b0b0b, 0xff0a0a0a, 0xff0a0a0a, 0xff090909, 0xff090909, 0xff0a0a0a, 0xff0a0a0a, 0xff050504,
+    0xff080808, 0xff101010, 0xff101010, 0xff111111, 0xff101010, 0xff0f0f0f, 0xff0d0d0d, 0xff0c0c0c,
+    0xff0d0d0d, 0xff0f0f0f, 0xff131313, 0xff191919, 0xff202020, 0xff292929, 0xff222222, 0xf00a0a0a,
+    0x93030303, 0x77000000, 0x5b000000, 0x35000000, 0x17000000, 0x08000000, 0x02000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7b000000,
+    0xff141414, 0xff272727, 0xff282828, 0xff2a2a2a, 0xff2b2b2b, 0xff2c2c2c, 0xff2b2b2b, 0xff292929,
+    0xff282828, 0xff282828, 0xff272727, 0xff252525, 0xff232323, 0xff212121, 0xff1a1a1a, 0xff090909,
+    0xff141414, 0xff141414, 0xff111111, 0xff111111, 0xff101010, 0xff0f1010, 0xff0f0f0f, 0xff10100f,
+    0xff0e0e0e, 0xff0d0d0d, 0xff0c0c0c, 0xff0b0b0b, 0xff0a0a0a, 0xff090a09, 0xff030304, 0xff040404,
+    0xff070707, 0xff080807, 0xff090909, 0xff0a0a0a, 0xff0b0b0b, 0xff0c0c0c, 0xff0e0f0f, 0xff0f0e0f,
+    0xff0f0f0f, 0xff0f0f0f, 0xff0f0f0f, 0xff0d0e0d, 0xff0f0f0f, 0xff0d0d0d, 0xff0f0f0f, 0xff080808,
+    0xff0a0a0a, 0xff141414, 0xff151515, 0xff161616, 0xff151515, 0xff131313, 0xff111111, 0xff0f0f0f,
+    0xff111111, 0xff141414, 0xff181818, 0xff1e1e1e, 0xff262626, 0xff2e2e2e, 0xff282828, 0xf00c0c0c,
+    0x92020202, 0x69000000, 0x42000000, 0x1c000000, 0x08000000, 0x01000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88000000,
+    0xff161616, 0xff292929, 0xff2a2a2a, 0xff2c2c2c, 0xff2e2e2e, 0xff2e2e2e, 0xff2f2f2f, 0xff2f2f2f,
+    0xff2d2d2d, 0xff2c2c2c, 0xff2a2a2a, 0xff2a2a2a, 0xff282828, 0xff262626, 0xff191919, 0xff0a0a0a,
+    0xff1a1a1a, 0xff191919, 0xff161616, 0xff161616, 0xff151515, 0xff151616, 0xff151615, 0xff151515,
+    0xff121212, 0xff101011, 0xff0f0e0e, 0xff0d0d0d, 0xff0b0b0b, 0xff090909, 0xff030303, 0xff060606,
+    0xff090809, 0xff0a0a0a, 0xff0c0c0b, 0xff0d0d0d, 0xff101010, 0xff121212, 0xff141414, 0xff141414,
+    0xff161616, 0xff151515, 0xff151515, 0xff141414, 0xff141414, 0xff141414, 0xff141414, 0xff0c0c0c,
+    0xff0a0a0a, 0xff171717, 0xff191919, 0xff191919, 0xff191919, 0xff171717, 0xff151515, 0xff151515,
+    0xff161616, 0xff181818, 0xff1d1d1d, 0xff222222, 0xff2a2a2a, 0xff323232, 0xff353535, 0xfb121212,
+    0x9d000000, 0x5e000000, 0x32000000, 0x10000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x58000000,
+    0xfe0e0e0e, 0xff282828, 0xff2c2c2c, 0xff2f2f2f, 0xff313131, 0xff323232, 0xff323232, 0xff333333,
+    0xff313131, 0xff303030, 0xff303030, 0xff2d2d2d, 0xff2c2c2c, 0xff292929, 0xff161616, 0xff0e0e0e,
+    0xff202020, 0xff1e1e1e, 0xff1b1b1b, 0xff1c1c1c, 0xff1b1b1b, 0xff1b1b1b, 0xff1b1b1b, 0xff1b1b1b,
+    0xff191919, 0xff161616, 0xff151414, 0xff121111, 0xff0f0f0f, 0xff0c0c0c, 0xff040404, 0xff070707,
+    0xff0d0c0d, 0xff0c0c0d, 0xff101010, 0xff131313, 0xff151515, 0xff181818, 0xff1a1a1a, 0xff1b1b1b,
+    0xff1c1c1c, 0xff1c1c1c, 0xff1b1b1b, 0xff1a1a1a, 0xff191919, 0xff1a1a1a, 0xff1b1b1b, 0xff121212,
+    0xff0a0a0a, 0xff1c1c1c, 0xff1f1f1f, 0xff1e1e1e, 0xff1d1d1d, 0xff1c1c1c, 0xff1a1a1a, 0xff1a1a1a,
+    0xff1b1b1b, 0xff1f1f1f, 0xff232323, 0xff292929, 0xff303030, 0xff383838, 0xff414141, 0xff1d1d1d,
+    0xb2000000, 0x5e000000, 0x32000000, 0x0f000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x25000000,
+    0xde050505, 0xff222222, 0xff2d2d2d, 0xff2f2f2f, 0xff313131, 0xff343434, 0xff343434, 0xff343434,
+    0xff353535, 0xff333333, 0xff333333, 0xff313131, 0xff2f2f2f, 0xff2d2d2d, 0xff121212, 0xff151515,
+    0xff242424, 0xff222222, 0xff202020, 0xff212121, 0xff212121, 0xff222222, 0xff222222, 0xff202020,
+    0xff1f1f1f, 0xff1d1d1d, 0xff1b1b1b, 0xff171717, 0xff141414, 0xff121212, 0xff060606, 0xff0a0a0a,
+    0xff111111, 0xff131313, 0xff151515, 0xff191919, 0xff1c1c1c, 0xff1e1e1e, 0xff1f1f1f, 0xff222222,
+    0xff222222, 0xff232323, 0xff212121, 0xff222222, 0xff202020, 0xff202020, 0xff222222, 0xff171717,
+    0xff0d0d0d, 0xff212121, 0xff242424, 0xff232323, 0xff212121, 0xff212121, 0xff202020, 0xff202020,
+    0xff222222, 0xff252525, 0xff2a2a2a, 0xff303030, 0xff373737, 0xff3e3e3e, 0xff464646, 0xff262626,
+    0xc4020202, 0x66000000, 0x39000000, 0x13000000, 0x03000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06000000,
+    0xa3010101, 0xff161616, 0xff2b2b2b, 0xff2f2f2f, 0xff303030, 0xff313131, 0xff333333, 0xff343434,
+    0xff343434, 0xff343434, 0xff353535, 0xff323232, 0xff313131, 0xff2d2d2d, 0xff0e0e0e, 0xff1e1e1e,
+    0xff282828, 0xff252525, 0xff252525, 0xff252525, 0xff272727, 0xff272727, 0xff262626, 0xff262626,
+    0xff262626, 0xff242424, 0xff212121, 0xff1e1e1e, 0xff1b1b1b, 0xff191919, 0xff090909, 0xff0f0f0f,
+    0xff171717, 0xff181818, 0xff1b1b1b, 0xff1e1e1e, 0xff212121, 0xff232323, 0xff252525, 0xff272727,
+    0xff262626, 0xff272727, 0xff272727, 0xff272727, 0xff272727, 0xff262626, 0xff272727, 0xff1c1c1c,
+    0xff0d0d0d, 0xff252525, 0xff282828, 0xff282828, 0xff272727, 0xff272727, 0xff262626, 0xff262626,
+    0xff272727, 0xff2b2b2b, 0xff2f2f2f, 0xff343434, 0xff3d3d3d, 0xff424242, 0xff494949, 0xff2d2d2d,
+    0xd0020202, 0x6e000000, 0x40000000, 0x17000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4b000000, 0xe2040404, 0xff151515, 0xff242424, 0xff2d2d2d, 0xff2f2f2f, 0xff303030, 0xff323232,
+    0xff333333, 0xff333333, 0xff333333, 0xff323232, 0xff313131, 0xff2a2a2a, 0xff0e0e0e, 0xff232323,
+    0xff292929, 0xff282828, 0xff292929, 0xff292929, 0xff2a2a2a, 0xff2b2b2b, 0xff2c2c2c, 0xff2c2c2c,
+    0xff2b2b2b, 0xff2a2a2a, 0xff282828, 0xff252525, 0xff232323, 0xff202020, 0xff0b0b0b, 0xff121212,
+    0xff1e1e1e, 0xff1d1d1d, 0xff202020, 0xff222222, 0xff252525, 0xff272727, 0xff2a2a2a, 0xff2b2b2b,
+    0xff2b2b2b, 0xff2c2c2c, 0xff2c2c2c, 0xff2b2b2b, 0xff2b2b2b, 0xff2b2b2b, 0xff2c2c2c, 0xff212121,
+    0xff0e0e0e, 0xff282828, 0xff2d2d2d, 0xff2c2c2c, 0xff2a2a2a, 0xff292929, 0xff292929, 0xff2a2a2a,
+    0xff2c2c2c, 0xff303030, 0xff353535, 0xff383838, 0xff3e3e3e, 0xff434343, 0xff484848, 0xff212121,
+    0xc2000000, 0x70000000, 0x45000000, 0x1a000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000,
+    0x0f000000, 0x53000000, 0xb3010101, 0xf6080808, 0xff151515, 0xff232323, 0xff2a2a2a, 0xff2c2c2c,
+    0xff2f2f2f, 0xff303030, 0xff303030, 0xff313131, 0xff303030, 0xff272727, 0xff0e0e0e, 0xff232323,
+    0xff292929, 0xff292929, 0xff2a2a2a, 0xff2a2a2a, 0xff2c2c2c, 0xff2d2d2d, 0xff2e2e2e, 0xff2e2e2e,
+    0xff2f2f2f, 0xff2e2e2e, 0xff2c2c2c, 0xff2a2a2a, 0xff292929, 0xff242424, 0xff080808, 0xff0b0b0b,
+    0xff212121, 0xff222222, 0xff232323, 0xff262626, 0xff282828, 0xff2a2a2a, 0xff2c2c2c, 0xff2c2c2c,
+    0xff2c2c2c, 0xff2d2d2d, 0xff2d2d2d, 0xff2e2e2e, 0xff2d2d2d, 0xff2e2e2e, 0xff303030, 0xff242424,
+    0xff0f0f0f, 0xff2b2b2b, 0xff2e2e2e, 0xff2e2e2e, 0xff2c2c2c, 0xff2b2b2b, 0xff2c2c2c, 0xff2b2b2b,
+    0xff2d2d2d, 0xff303030, 0xff343434, 0xff393939, 0xff3e3e3e, 0xff444444, 0xff343434, 0xee080808,
+    0x97000000, 0x6e000000, 0x45000000, 0x1a000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000,
+    0x07000000, 0x19000000, 0x3f000000, 0x7e000000, 0xc4010101, 0xf5060606, 0xff111111, 0xff171717,
+    0xff1c1c1c, 0xff1f1f1f, 0xff212121, 0xff242424, 0xff262626, 0xff202020, 0xff0d0d0d, 0xff212121,
+    0xff282828, 0xff282828, 0xff282828, 0xff282828, 0xff2b2b2b, 0xff2c2c2c, 0xff2d2d2d, 0xff2f2f2f,
+    0xff303030, 0xff303030, 0xff2f2f2f, 0xff2e2e2e, 0xff2d2d2d, 0xff202020, 0xed050505, 0xe5030303,
+    0xff151515, 0xff262626, 0xff262626, 0xff272727, 0xff282828, 0xff2a2a2a, 0xff2a2a2a, 0xff2b2b2b,
+    0xff2b2b2b, 0xff2b2b2b, 0xff2d2d2d, 0xff2e2e2e, 0xff2f2f2f, 0xff2f2f2f, 0xff313131, 0xff252525,
+    0xff0f0f0f, 0xff2b2b2b, 0xff2f2f2f, 0xff2e2e2e, 0xff2d2d2d, 0xff2b2b2b, 0xff2a2a2a, 0xff2c2c2c,
+    0xff2e2e2e, 0xff313131, 0xff333333, 0xff373737, 0xff393939, 0xff272727, 0xf50b0b0b, 0xb5010101,
+    0x81000000, 0x68000000, 0x3b000000, 0x14000000, 0x04000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x03000000, 0x0d000000, 0x1f000000, 0x36000000, 0x53000000, 0x83000000, 0xb4010101, 0xcb020202,
+    0xd3020202, 0xdb030303, 0xe6040404, 0xef070707, 0xf50a0a0a, 0xfd0a0a0a, 0xff050505, 0xff131313,
+    0xff1e1e1e, 0xff232323, 0xff252525, 0xff262626, 0xff272727, 0xff292929, 0xff2a2a2a, 0xff2b2b2b,
+    0xff2d2d2d, 0xff2f2f2f, 0xff2f2f2f, 0xff2e2e2e, 0xff2c2c2c, 0xff151515, 0xc3030303, 0xa7010101,
+    0xfc0a0a0a, 0xff222222, 0xff252525, 0xff262626, 0xff272727, 0xff282828, 0xff272727, 0xff272727,
+    0xff282828, 0xff292929, 0xff292929, 0xff2b2b2b, 0xff2c2c2c, 0xff2c2c2c, 0xff2e2e2e, 0xff232323,
+    0xff0f0f0f, 0xff292929, 0xff292929, 0xff252525, 0xff262626, 0xff252525, 0xff232323, 0xff242424,
+    0xff252525, 0xff262626, 0xff222222, 0xff1c1c1c, 0xff121212, 0xe3040404, 0xa6010101, 0x84010101,
+    0x74000000, 0x54000000, 0x29000000, 0x0c000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x01000000, 0x03000000, 0x0a000000, 0x16000000, 0x28000000, 0x3a000000, 0x4f000000, 0x63000000,
+    0x70000000, 0x7b000000, 0x85000000, 0x8e000000, 0x95000000, 0x9e000000, 0xb6010101, 0xd2020202,
+    0xef050505, 0xff0d0d0d, 0xff141414, 0xff1c1c1c, 0xff212121, 0xff252525, 0xff272727, 0xff292929,
+    0xff2b2b2b, 0xff2d2d2d, 0xff2c2c2c, 0xff2c2c2c, 0xff202020, 0xf80a0a0a, 0x9f020202, 0x86000000,
+    0xd5020202, 0xff121212, 0xff212121, 0xff232323, 0xff232323, 0xff232323, 0xff242424, 0xff242424,
+    0xff242424, 0xff242424, 0xff252525, 0xff272727, 0xff282828, 0xff292929, 0xff2b2b2b, 0xff1e1e1e,
+    0xff0a0a0a, 0xff121212, 0xf70b0b0b, 0xf2090909, 0xf80b0b0b, 0xfd0b0b0b, 0xfd0b0b0b, 0xfb0b0b0b,
+    0xf3080808, 0xe9050505, 0xe1040404, 0xcf030303, 0xaf000000, 0x8f000000, 0x7c000000, 0x71000000,
+    0x59000000, 0x36000000, 0x16000000, 0x05000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x02000000, 0x05000000, 0x0b000000, 0x17000000, 0x26000000, 0x37000000,
+    0x44000000, 0x4c000000, 0x51000000, 0x54000000, 0x58000000, 0x5c000000, 0x61000000, 0x6a000000,
+    0x84000000, 0xaf010101, 0xd9030303, 0xf3050505, 0xff0b0b0b, 0xff121212, 0xff141414, 0xff161616,
+    0xff181818, 0xff1c1c1c, 0xff1a1a1a, 0xff111111, 0xf3070707, 0xbb010101, 0x82000000, 0x72000000,
+    0x7f000000, 0xd3010101, 0xfd0b0b0b, 0xff131313, 0xff161616, 0xff161616, 0xff171717, 0xff181818,
+    0xff181818, 0xff191919, 0xff1a1a1a, 0xff1c1c1c, 0xff1d1d1d, 0xff1e1e1e, 0xff1e1e1e, 0xff101010,
+    0xf4000000, 0xbd000000, 0xa2000000, 0x9c000000, 0x9f010101, 0xa1010101, 0xa0000000, 0x9e000000,
+    0x96010101, 0x8b000000, 0x82000000, 0x7c000000, 0x75000000, 0x6f000000, 0x63000000, 0x4d000000,
+    0x31000000, 0x18000000, 0x08000000, 0x02000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x02000000, 0x05000000, 0x0a000000, 0x12000000,
+    0x19000000, 0x1f000000, 0x23000000, 0x26000000, 0x2b000000, 0x30000000, 0x35000000, 0x3b000000,
+    0x44000000, 0x50000000, 0x65000000, 0x83000000, 0xab000000, 0xc0000000, 0xca000000, 0xd0000000,
+    0xd5000000, 0xda010101, 0xd5000000, 0xb9000000, 0x98010101, 0x80000000, 0x73000000, 0x59000000,
+    0x3f000000, 0x53000000, 0x94000000, 0xc4000000, 0xda020202, 0xe2030303, 0xe9030303, 0xee050505,
+    0xec040404, 0xee040404, 0xf0050505, 0xf0050505, 0xf0060606, 0xed050505, 0xe9040404, 0xda010101,
+    0xa4000000, 0x80000000, 0x78000000, 0x6d000000, 0x64000000, 0x60000000, 0x60000000, 0x61000000,
+    0x61000000, 0x60000000, 0x5d000000, 0x59000000, 0x52000000, 0x45000000, 0x35000000, 0x23000000,
+    0x12000000, 0x07000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x01000000, 0x03000000,
+    0x05000000, 0x06000000, 0x08000000, 0x0a000000, 0x0c000000, 0x0d000000, 0x10000000, 0x14000000,
+    0x1c000000, 0x27000000, 0x36000000, 0x44000000, 0x51000000, 0x5f000000, 0x6c000000, 0x76000000,
+    0x7b000000, 0x7f000000, 0x7d000000, 0x74000000, 0x71000000, 0x67000000, 0x53000000, 0x36000000,
+    0x20000000, 0x20000000, 0x38000000, 0x5a000000, 0x72000000, 0x7e000000, 0x85000000, 0x87000000,
+    0x88000000, 0x89000000, 0x8c000000, 0x8d000000, 0x8e000000, 0x8d000000, 0x8c000000, 0x84000000,
+    0x78000000, 0x6f000000, 0x5c000000, 0x46000000, 0x3a000000, 0x35000000, 0x35000000, 0x35000000,
+    0x35000000, 0x32000000, 0x2e000000, 0x29000000, 0x23000000, 0x1a000000, 0x12000000, 0x0a000000,
+    0x04000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x01000000, 0x02000000, 0x02000000, 0x03000000,
+    0x06000000, 0x0b000000, 0x12000000, 0x1c000000, 0x28000000, 0x35000000, 0x41000000, 0x49000000,
+    0x4e000000, 0x50000000, 0x52000000, 0x51000000, 0x4a000000, 0x3c000000, 0x29000000, 0x16000000,
+    0x0b000000, 0x0c000000, 0x1b000000, 0x30000000, 0x41000000, 0x4d000000, 0x52000000, 0x56000000,
+    0x58000000, 0x59000000, 0x59000000, 0x5b000000, 0x5d000000, 0x5d000000, 0x5d000000, 0x5c000000,
+    0x56000000, 0x47000000, 0x32000000, 0x1e000000, 0x14000000, 0x10000000, 0x10000000, 0x10000000,
+    0x10000000, 0x0f000000, 0x0d000000, 0x0b000000, 0x08000000, 0x05000000, 0x03000000, 0x01000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x02000000, 0x03000000, 0x06000000, 0x0a000000, 0x11000000, 0x17000000, 0x1c000000,
+    0x20000000, 0x22000000, 0x24000000, 0x23000000, 0x1e000000, 0x15000000, 0x0c000000, 0x05000000,
+    0x02000000, 0x02000000, 0x07000000, 0x0f000000, 0x18000000, 0x20000000, 0x25000000, 0x28000000,
+    0x2a000000, 0x2b000000, 0x2c000000, 0x2d000000, 0x2e000000, 0x2f000000, 0x2f000000, 0x2d000000,
+    0x28000000, 0x1d000000, 0x11000000, 0x07000000, 0x03000000, 0x02000000, 0x02000000, 0x02000000,
+    0x02000000, 0x02000000, 0x01000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x02000000, 0x04000000, 0x05000000,
+    0x06000000, 0x08000000, 0x08000000, 0x07000000, 0x06000000, 0x03000000, 0x02000000, 0x01000000,
+    0x00000000, 0x00000000, 0x01000000, 0x02000000, 0x05000000, 0x06000000, 0x08000000, 0x0a000000,
+    0x0b000000, 0x0b000000, 0x0b000000, 0x0c000000, 0x0d000000, 0x0d000000, 0x0d000000, 0x0c000000,
+    0x0a000000, 0x06000000, 0x03000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x01000000, 0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x01000000,
+    0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000, 0x01000000,
+    0x01000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
@@ -0,0 +1,21 @@
+#ifndef KITTYARTWORK_H
+#define KITTYARTWORK_H
+
+#include <juce.h>
+
+//==============================================================================
+/*
+    The editor's artwork, already decoded from the png that the Jucer embeds in
+    kittyEditor.cpp, as premultiplied ARGB pixels, one row after another. The
+    editor builds its image straight from these, so opening one never has to
+    decode anything. kittyArtwork.cpp is generated by tools/kittyArtworkPixels.py.
+*/
+enum
+{
+    kittyArtworkWidth = 128,
+    kittyArtworkHeight = 128
+};
+
+extern const uint32 kittyArtworkPixels [kittyArtworkWidth * kittyArtworkHeight];
+
+#endif
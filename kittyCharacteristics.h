@@ -10,10 +10,11 @@
 #define JucePlugin_MaxNumOutputChannels             2
 #define JucePlugin_PreferredChannelConfigurations   { 1, 1 }, { 2, 2 }
 #define JucePlugin_IsSynth                          0
-#define JucePlugin_WantsMidiInput                   1
-#define JucePlugin_ProducesMidiOutput               1
+#define JucePlugin_WantsMidiInput                   0
+#define JucePlugin_ProducesMidiOutput               0
 #define JucePlugin_SilenceInProducesSilenceOut      0
 #define JucePlugin_EditorRequiresKeyboardFocus      1
+#define JucePlugin_HasReducedRateExport             1
 #define JucePlugin_VersionCode              0x00010100
 #define JucePlugin_VersionString            "1.1"
 #define JUCE_USE_VSTSDK_2_4                 1
@@ -20,12 +20,18 @@
 */
 
 //[Headers] You can add your own extra header files here...
+#include "wrapper/juce_ProcessTimingHistogram.h"
+#include "wrapper/juce_StartupTimings.h"
+#include "kittyArtwork.h"
 //[/Headers]
 
 #include "kittyEditor.h"
 
 
 //[MiscUserDefs] You can add your own user definitions and misc code here...
+static CriticalSection artworkLock;
+static Image* retainedArtwork = 0;
+static int numArtworkUsers = 0;
 //[/MiscUserDefs]
 
 //==============================================================================
@@ -79,33 +85,56 @@ kittyEditor::kittyEditor (kitty *owner)
     sampleRateLabel->setColour (TextEditor::textColourId, Colours::black);
     sampleRateLabel->setColour (TextEditor::backgroundColourId, Colour (0x0));
 
-    internalCachedImage3 = ImageCache::getFromMemory (kitty_png, kitty_pngSize);
+    retainArtwork();
+    internalCachedImage3 = retainedArtwork;
 
     //[UserPreSize]
+    loadLabel = 0;
+    scope = 0;
+    spectrum = 0;
+    background = 0;
+    isRenderingBackground = false;
+    setOpaque (true);
     //[/UserPreSize]
 
-    setSize (256, 128);
+    setSize (256, 192);
 
     //[Constructor] You can add your own custom stuff here..
 
-    owner->addChangeListener (this);
-    bitDepthSlider->setValue ((double)(owner->getParameter (kitty::kBitDepth) * 32), false);
-    sampleRateSlider->setValue (owner->getParameter (kitty::kSampleRate), false);
+    updateSliders();
+
+    addAndMakeVisible (loadLabel = new Label (T("Load"), String::empty));
+    loadLabel->setFont (Font (10.0f));
+    loadLabel->setJustificationType (Justification::centredLeft);
+    loadLabel->setColour (Label::textColourId, Colour (0xff404040));
+    loadLabel->setInterceptsMouseClicks (false, false);
+    loadLabel->setBounds (2, 114, 110, 12);
+
+    showSpectrum (owner->getEditorShowsSpectrum());
+
+    // the sliders and meter only need to keep up with the eye, so a slow refresh keeps it cheap
+    startTimer (1000 / 8);
     //[/Constructor]
 }
 
 kittyEditor::~kittyEditor()
 {
     //[Destructor_pre]. You can add your own custom destruction code here..
+    stopTimer();
+    deleteAndZero (loadLabel);
+    deleteAndZero (scope);
+    deleteAndZero (spectrum);
     //[/Destructor_pre]
 
     deleteAndZero (bitDepthSlider);
     deleteAndZero (bitDepthLabel);
     deleteAndZero (sampleRateSlider);
     deleteAndZero (sampleRateLabel);
-    ImageCache::release (internalCachedImage3);
+    internalCachedImage3 = 0;
+    releaseArtwork();
 
     //[Destructor]. You can add your own custom destruction code here..
+    deleteAndZero (background);
     //[/Destructor]
 }
 
@@ -113,6 +142,13 @@ kittyEditor::~kittyEditor()
 void kittyEditor::paint (Graphics& g)
 {
     //[UserPrePaint] Add your own custom painting code here..
+    // nothing here changes after resized(), so it's drawn into an image once and
+    // just copied back from then on
+    if (background != 0 && ! isRenderingBackground)
+    {
+        g.drawImageAt (background, 0, 0);
+        return;
+    }
     //[/UserPrePaint]
 
     g.fillAll (Colours::white);
@@ -150,6 +186,13 @@ void kittyEditor::resized()
     internalPath1.closeSubPath();
 
     //[UserResized] Add your own custom resize handling here..
+    deleteAndZero (background);
+    background = new Image (Image::RGB, jmax (1, getWidth()), jmax (1, getHeight()), true);
+
+    Graphics bg (*background);
+    isRenderingBackground = true;
+    paint (bg);
+    isRenderingBackground = false;
     //[/UserResized]
 }
 
@@ -178,20 +221,165 @@ void kittyEditor::sliderValueChanged (Slider* sliderThatWasMoved)
 
 
 //[MiscUserCode] You can add your own definitions of your custom methods or any other code here...
-void kittyEditor::changeListenerCallback (void* source)
+void kittyEditor::updateSliders()
 {
     kitty* const filter = getFilter();
 
-    filter->getCallbackLock().enter();
-
     const float sampleRate = filter->getParameter (kitty::kSampleRate);
     const float bitDepth = filter->getParameter (kitty::kBitDepth);
 
-    filter->getCallbackLock().exit();
-
     bitDepthSlider->setValue ((double)(bitDepth*32), false);
     sampleRateSlider->setValue (sampleRate, false);
 }
+
+void kittyEditor::timerCallback()
+{
+    // the filter doesn't send change messages (so that it never needs the message
+    // thread), so automation and preset changes are picked up from here
+    updateSliders();
+
+    float load, peakLoad, blockMicros;
+    bool silent;
+    int numSilentBlocks;
+
+    getFilter()->getLoadStats (load, peakLoad, blockMicros, silent, numSilentBlocks);
+
+    const String text (silent ? String::formatted (T("dsp %.1f%% pk %.1f%% silent"),
+                                                   100.0f * load, 100.0f * peakLoad)
+                              : String::formatted (T("dsp %.1f%% pk %.1f%% %.0fus"),
+                                                   100.0f * load, 100.0f * peakLoad, blockMicros));
+
+    // (Label only repaints if the text has actually changed)
+    loadLabel->setText (text, false);
+
+    if (spectrum != 0)
+        spectrum->setFoldingPoint (getFilter()->getParameter (kitty::kSampleRate));
+}
+
+void kittyEditor::showSpectrum (const bool shouldShowSpectrum)
+{
+    // only one of them exists at a time, so the other one's collector is switched
+    // off and deleted, and the analyser thread is only running while it's being looked at
+    deleteAndZero (scope);
+    deleteAndZero (spectrum);
+
+    kitty* const filter = getFilter();
+    filter->setEditorShowsSpectrum (shouldShowSpectrum);
+
+    if (shouldShowSpectrum)
+    {
+        addAndMakeVisible (spectrum = new kittySpectrum (*filter));
+        spectrum->setBounds (0, 128, 256, 64);
+        spectrum->setFoldingPoint (filter->getParameter (kitty::kSampleRate));
+    }
+    else
+    {
+        addAndMakeVisible (scope = new kittyScope (*filter));
+        scope->setBounds (0, 128, 256, 64);
+    }
+}
+
+void kittyEditor::retainArtwork()
+{
+    const ScopedLock sl (artworkLock);
+
+    if (numArtworkUsers++ == 0)
+    {
+        // the pixels are already decoded, so this is just a copy
+        retainedArtwork = new Image (Image::ARGB, kittyArtworkWidth, kittyArtworkHeight, false);
+
+        int lineStride, pixelStride;
+        uint8* const pixels = retainedArtwork->lockPixelDataReadWrite (0, 0, kittyArtworkWidth, kittyArtworkHeight,
+                                                                       lineStride, pixelStride);
+
+        for (int y = 0; y < kittyArtworkHeight; ++y)
+        {
+            uint8* dest = pixels + y * lineStride;
+            const uint32* src = kittyArtworkPixels + y * kittyArtworkWidth;
+
+            for (int x = 0; x < kittyArtworkWidth; ++x)
+            {
+                ((PixelARGB*) dest)->setARGB ((uint8) (*src >> 24), (uint8) (*src >> 16),
+                                              (uint8) (*src >> 8), (uint8) *src);
+                dest += pixelStride;
+                ++src;
+            }
+        }
+
+        retainedArtwork->releasePixelDataReadWrite (pixels);
+    }
+}
+
+void kittyEditor::releaseArtwork()
+{
+    const ScopedLock sl (artworkLock);
+    jassert (numArtworkUsers > 0);
+
+    if (--numArtworkUsers == 0)
+        deleteAndZero (retainedArtwork);
+}
+
+void kittyEditor::mouseDown (const MouseEvent& e)
+{
+    // clicking on the background pops up the display options, and the callback
+    // timings that the wrapper is keeping
+    PopupMenu m;
+    m.addItem (3, T("Show spectrum"), true, spectrum != 0);
+
+    ProcessTimingHistogram* const timings = getProcessTimingHistogramFor (getFilter());
+
+    if (timings != 0)
+    {
+        StringArray summary;
+        summary.addLines (timings->getSummaryText());
+        summary.removeEmptyStrings();
+
+        m.addSeparator();
+
+        for (int i = 0; i < summary.size(); ++i)
+            m.addItem (100 + i, summary[i], false);
+
+        const PluginStartupTimings* const startup = getStartupTimingsFor (getFilter());
+
+        if (startup != 0)
+        {
+            StringArray phases;
+            phases.addLines (startup->getDescription());
+            phases.removeEmptyStrings();
+
+            PopupMenu startupMenu;
+
+            for (int i = 0; i < phases.size(); ++i)
+                startupMenu.addItem (200 + i, phases[i], false);
+
+            m.addSubMenu (T("Startup timings"), startupMenu);
+        }
+
+        m.addSeparator();
+        m.addItem (1, T("Save timing histogram..."));
+        m.addItem (2, T("Reset timing histogram"));
+    }
+
+    const int result = m.show();
+
+    if (result == 3)
+    {
+        showSpectrum (spectrum == 0);
+    }
+    else if (result == 1)
+    {
+        FileChooser fc (T("Save timing histogram"),
+                        File::getSpecialLocation (File::userDesktopDirectory).getChildFile (T("kitty timings.txt")),
+                        T("*.txt"));
+
+        if (fc.browseForFileToSave (true))
+            timings->writeToFile (fc.getResult());
+    }
+    else if (result == 2)
+    {
+        timings->reset();
+    }
+}
 //[/MiscUserCode]
 
 
@@ -204,10 +392,10 @@ void kittyEditor::changeListenerCallback (void* source)
 BEGIN_JUCER_METADATA
 
 <JUCER_COMPONENT documentType="Component" className="kittyEditor" componentName="Kitty Editor"
-                 parentClasses="public AudioProcessorEditor, public ChangeListener"
+                 parentClasses="public AudioProcessorEditor, public Timer"
                  constructorParams="kitty *owner" variableInitialisers="AudioProcessorEditor (owner)"
                  snapPixels="8" snapActive="1" snapShown="1" overlayOpacity="0.330000013"
-                 fixedSize="1" initialWidth="256" initialHeight="128">
+                 fixedSize="1" initialWidth="256" initialHeight="192">
   <BACKGROUND backgroundColour="ffffffff">
     <PATH pos="0 0 100 100" fill="linear: 120 0, 120 128, 0=68c7c7c7, 1=80999999"
           hasStroke="1" stroke="0.800000012, mitered, butt" strokeColour="solid: ff000000"
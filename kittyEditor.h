@@ -38,7 +38,7 @@
                                                                     //[/Comments]
 */
 class kittyEditor  : public AudioProcessorEditor,
-                     public ChangeListener,
+                     public Timer,
                      public SliderListener
 {
 public:
@@ -48,8 +48,21 @@ public:
 
     //==============================================================================
     //[UserMethods]     -- You can add your own custom methods in this section.
-    void changeListenerCallback (void* source);
+    void updateSliders();
     kitty* getFilter() const throw()       { return (kitty*) getAudioProcessor(); }
+    void mouseDown (const MouseEvent& e);
+    void timerCallback();
+
+    /** Swaps the scope at the bottom for the spectrum analyser, or back. */
+    void showSpectrum (const bool shouldShowSpectrum);
+
+    /** Builds the artwork image from the pixels in kittyArtwork.cpp, which are
+        already decoded, and shares it between editors. Each editor holds a
+        reference while it's open, and so does each kitty that has shown one,
+        so reopening an editor doesn't even have to copy the pixels again.
+    */
+    static void retainArtwork();
+    static void releaseArtwork();
     //[/UserMethods]
 
     void paint (Graphics& g);
@@ -65,6 +78,11 @@ public:
 
 private:
     //[UserVariables]   -- You can add your own custom variables in this section.
+    Label* loadLabel;
+    kittyScope* scope;
+    kittySpectrum* spectrum;
+    Image* background;
+    bool isRenderingBackground;
     //[/UserVariables]
 
     //==============================================================================
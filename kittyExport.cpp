@@ -0,0 +1,173 @@
+#include "kittyExport.h"
+#include "kitty.h"
+
+// the number of frames read, decimated and written at a time
+static const int exportBlockSize = 8192;
+
+//==============================================================================
+kittyExporter::kittyExporter (kitty& filter_)
+    : filter (filter_),
+      inputSampleRate (0),
+      inputBitsPerSample (0),
+      outputSampleRate (0),
+      outputBitsPerSample (0),
+      numFramesRead (0),
+      numFramesWritten (0)
+{
+}
+
+kittyExporter::~kittyExporter()
+{
+}
+
+/** The smallest sample size that a WAV file can have which fits a bit depth. */
+static int getPackedBitsPerSample (const int bitDepth)
+{
+    if (bitDepth <= 8)
+        return 8;
+
+    if (bitDepth <= 16)
+        return 16;
+
+    return bitDepth <= 24 ? 24 : 32;
+}
+
+const String kittyExporter::exportFile (const File& source_, const File& dest_, const bool packToBitDepth)
+{
+    source = source_;
+    dest = dest_;
+    numFramesRead = numFramesWritten = 0;
+
+    FileInputStream* const in = source.createInputStream();
+
+    if (in == 0)
+        return T("Couldn't open ") + source.getFullPathName();
+
+    WavAudioFormat wavFormat;
+    AudioFormatReader* const reader = wavFormat.createReaderFor (in, true);
+
+    if (reader == 0)
+        return T("Couldn't read ") + source.getFullPathName() + T(" as a WAV file");
+
+    const int numChannels = (int) reader->numChannels;
+    inputSampleRate = reader->sampleRate;
+    inputBitsPerSample = (int) reader->bitsPerSample;
+    outputSampleRate = roundDoubleToInt (filter.getHeldSampleRate (inputSampleRate));
+    outputBitsPerSample = packToBitDepth ? getPackedBitsPerSample (filter.getBitDepth()) : 32;
+
+    if (numChannels == 0 || outputSampleRate <= 0)
+    {
+        delete reader;
+
+        return numChannels == 0 ? T("There's no audio in ") + source.getFullPathName()
+                                : T("At this sample rate setting, no samples would be held");
+    }
+
+    FileOutputStream* const out = dest.deleteFile() ? dest.createOutputStream (1 << 18) : 0;
+
+    if (out == 0)
+    {
+        delete reader;
+        return T("Couldn't replace ") + dest.getFullPathName();
+    }
+
+    AudioFormatWriter* const writer = wavFormat.createWriterFor (out, outputSampleRate, numChannels,
+                                                                 outputBitsPerSample, StringPairArray(), 0);
+
+    if (writer == 0)
+    {
+        delete out;
+        delete reader;
+        return T("Couldn't create a WAV file with those settings");
+    }
+
+    AudioSampleBuffer buffer (numChannels, exportBlockSize);
+    int* const intData = (int*) juce_calloc (sizeof (int) * numChannels * exportBlockSize);
+    int** const intChannels = (int**) juce_calloc (sizeof (int*) * (numChannels + 1));
+    float** const channels = (float**) juce_calloc (sizeof (float*) * (numChannels + 1));
+
+    int i;
+    for (i = 0; i < numChannels; ++i)
+    {
+        intChannels[i] = intData + i * exportBlockSize;
+        channels[i] = buffer.getSampleData (i, 0);
+    }
+
+    filter.resetHeldSamples();
+
+    // (scaled by 2^31 each way rather than by 0x7fffffff, so that a sample that's
+    //  already at the bit depth comes back out exactly as it went in)
+    const double intScale = 2147483648.0;
+
+    while (numFramesRead < reader->lengthInSamples)
+    {
+        const int num = (int) jmin ((int64) exportBlockSize, reader->lengthInSamples - numFramesRead);
+
+        reader->read (intChannels, numFramesRead, num);
+
+        for (i = 0; i < numChannels; ++i)
+        {
+            if (reader->usesFloatingPointData)
+            {
+                memcpy (channels[i], intChannels[i], sizeof (float) * num);
+            }
+            else
+            {
+                for (int j = 0; j < num; ++j)
+                    channels[i][j] = (float) (intChannels[i][j] / intScale);
+            }
+        }
+
+        const int numHeld = filter.decimateToHeldSamples (channels, numChannels, num);
+
+        // the writer wants full-scale 32-bit ints, whatever its bit depth is
+        for (i = 0; i < numChannels; ++i)
+            for (int j = 0; j < numHeld; ++j)
+                intChannels[i][j] = (int) jlimit (-intScale, intScale - 1.0, channels[i][j] * intScale);
+
+        writer->write ((const int**) intChannels, numHeld);
+
+        numFramesRead += num;
+        numFramesWritten += numHeld;
+    }
+
+    delete writer;
+    delete reader;
+
+    juce_free (channels);
+    juce_free (intChannels);
+    juce_free (intData);
+
+    return String::empty;
+}
+
+const String kittyExporter::getSummary() const
+{
+    const int64 sourceSize = source.getSize();
+    const int64 destSize = dest.getSize();
+
+    return String::formatted (T("%d frames at %.0fHz, %d-bit in, %d frames at %dHz, %d-bit out"),
+                              (int) numFramesRead, inputSampleRate, inputBitsPerSample,
+                              (int) numFramesWritten, outputSampleRate, outputBitsPerSample)
+            + String::formatted (T(", %.1fx smaller"), destSize > 0 ? sourceSize / (double) destSize : 0.0);
+}
+
+//==============================================================================
+// The standalone's headless "--export" mode calls this (see JucePlugin_HasReducedRateExport).
+const String JUCE_CALLTYPE exportPluginFilterAtReducedRate (AudioProcessor& filter,
+                                                            const File& source, const File& dest,
+                                                            const bool packToBitDepth, String& summary)
+{
+    kitty* const k = dynamic_cast <kitty*> (&filter);
+
+    if (k == 0)
+        return T("Only a single kitty can be exported at the reduced rate, not a chain");
+
+    kittyExporter exporter (*k);
+    const String error (exporter.exportFile (source, dest, packToBitDepth));
+
+    if (error.isEmpty())
+        summary = exporter.getSummary();
+
+    return error;
+}
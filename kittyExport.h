@@ -0,0 +1,60 @@
+#ifndef KITTYEXPORT_H
+#define KITTYEXPORT_H
+
+#include <juce.h>
+
+class kitty;
+
+//==============================================================================
+/**
+    Renders a WAV file offline through kitty's current settings, and writes out
+    only the samples that are held, at the rate they're held at.
+
+    With the sample rate at 0.25, each sample is held for four, so an ordinary
+    render carries four copies of everything. This writes each one once, into a
+    file whose rate is a quarter of the input's, so it's a quarter of the size
+    and plays back the same. The rate in the header is rounded to a whole
+    number of Hz, because that's all a WAV file can say.
+
+    Unpacked, the samples are written as 32-bit ints, which hold any bit depth
+    exactly. Packed, they're written at the smallest size that a WAV file can
+    have which fits the bit depth setting (8, 16, 24 or 32 bits). That's exact
+    too, because the quantising has already thrown the other bits away.
+
+    Only the standalone's headless mode uses this, so it's built into the
+    standalone along with its wrapper, and not into the plugin's project.
+*/
+class kittyExporter
+{
+public:
+    kittyExporter (kitty& filter);
+    ~kittyExporter();
+
+    /** Renders source into dest, replacing it, and returns an error message, or
+        an empty string if it worked.
+    */
+    const String exportFile (const File& source, const File& dest, const bool packToBitDepth);
+
+    //==============================================================================
+    int64 getNumFramesRead() const throw()              { return numFramesRead; }
+    int64 getNumFramesWritten() const throw()           { return numFramesWritten; }
+    int getOutputSampleRate() const throw()             { return outputSampleRate; }
+    int getOutputBitsPerSample() const throw()          { return outputBitsPerSample; }
+
+    /** Describes what the last export did, in a line. */
+    const String getSummary() const;
+
+    juce_UseDebuggingNewOperator
+
+private:
+    kitty& filter;
+    File source, dest;
+    double inputSampleRate;
+    int inputBitsPerSample, outputSampleRate, outputBitsPerSample;
+    int64 numFramesRead, numFramesWritten;
+
+    kittyExporter (const kittyExporter&);
+    const kittyExporter& operator= (const kittyExporter&);
+};
+
+#endif
@@ -0,0 +1,220 @@
+#include "kittyScope.h"
+#include "kitty.h"
+
+//==============================================================================
+kittyScopeCollector::kittyScopeCollector()
+    : fifo (fifoSize),
+      active (0),
+      numInputColumns (0)
+{
+    partialIn.lo = partialIn.hi = 0;
+    partialIn.numSamples = 0;
+    partialOut = partialIn;
+}
+
+kittyScopeCollector::~kittyScopeCollector()
+{
+}
+
+void kittyScopeCollector::setActive (const bool shouldBeActive) throw()
+{
+    active = shouldBeActive ? 1 : 0;
+}
+
+int kittyScopeCollector::reduce (const float* samples, int numSamples, PartialColumn& partial,
+                                 float* mins, float* maxs) throw()
+{
+    numSamples = jmin (numSamples, (int) (maxColumnsPerBlock - 1) * samplesPerColumn);
+
+    int i = 0, numDone = 0;
+
+    // finish off a column that the last block started
+    if (partial.numSamples > 0)
+    {
+        for (; i < numSamples && partial.numSamples < samplesPerColumn; ++i)
+        {
+            partial.lo = jmin (partial.lo, samples[i]);
+            partial.hi = jmax (partial.hi, samples[i]);
+            ++partial.numSamples;
+        }
+
+        if (partial.numSamples < samplesPerColumn)
+            return 0;
+
+        mins [numDone] = partial.lo;
+        maxs [numDone++] = partial.hi;
+        partial.numSamples = 0;
+    }
+
+    // whole columns
+    for (; i + samplesPerColumn <= numSamples; i += samplesPerColumn)
+    {
+        const float* const s = samples + i;
+        float lo = s[0], hi = s[0];
+
+        for (int j = 1; j < samplesPerColumn; ++j)
+        {
+            lo = jmin (lo, s[j]);
+            hi = jmax (hi, s[j]);
+        }
+
+        mins [numDone] = lo;
+        maxs [numDone++] = hi;
+    }
+
+    // and start a new one with anything left over
+    if (i < numSamples)
+    {
+        partial.lo = partial.hi = samples[i];
+        partial.numSamples = numSamples - i;
+
+        for (++i; i < numSamples; ++i)
+        {
+            partial.lo = jmin (partial.lo, samples[i]);
+            partial.hi = jmax (partial.hi, samples[i]);
+        }
+    }
+
+    return numDone;
+}
+
+void kittyScopeCollector::addInput (const float* samples, int numSamples) throw()
+{
+    numInputColumns = reduce (samples, numSamples, partialIn, inMins, inMaxs);
+}
+
+void kittyScopeCollector::addOutput (const float* samples, int numSamples) throw()
+{
+    const int numColumns = reduce (samples, numSamples, partialOut, outMins, outMaxs);
+
+    // (the input and output blocks are the same length, so these always match)
+    jassert (numColumns == numInputColumns);
+
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (jmin (numColumns, numInputColumns), start1, size1, start2, size2);
+
+    int i;
+    for (i = 0; i < size1; ++i)
+    {
+        Column& c = columns [start1 + i];
+        c.inMin = inMins[i];
+        c.inMax = inMaxs[i];
+        c.outMin = outMins[i];
+        c.outMax = outMaxs[i];
+    }
+
+    for (i = 0; i < size2; ++i)
+    {
+        Column& c = columns [start2 + i];
+        c.inMin = inMins [size1 + i];
+        c.inMax = inMaxs [size1 + i];
+        c.outMin = outMins [size1 + i];
+        c.outMax = outMaxs [size1 + i];
+    }
+
+    fifo.finishedWrite (size1 + size2);
+}
+
+int kittyScopeCollector::readColumns (Column* dest, int maxColumns) throw()
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead (maxColumns, start1, size1, start2, size2);
+
+    if (size1 > 0)
+        memcpy (dest, columns + start1, sizeof (Column) * size1);
+
+    if (size2 > 0)
+        memcpy (dest + size1, columns + start2, sizeof (Column) * size2);
+
+    fifo.finishedRead (size1 + size2);
+    return size1 + size2;
+}
+
+//==============================================================================
+kittyScope::kittyScope (kitty& owner_)
+    : Component (T("Scope")),
+      owner (owner_),
+      collector (0),
+      history (0),
+      incoming (0),
+      historySize (0),
+      historyPos (0)
+{
+    setOpaque (true);
+
+    incoming = (kittyScopeCollector::Column*) juce_calloc (sizeof (kittyScopeCollector::Column)
+                                                            * kittyScopeCollector::fifoSize);
+
+    collector = &owner.createScopeCollector();
+    collector->setActive (true);
+
+    startTimer (1000 / 30);
+}
+
+kittyScope::~kittyScope()
+{
+    collector->setActive (false);
+    owner.releaseScopeCollector();
+
+    juce_free (history);
+    juce_free (incoming);
+}
+
+void kittyScope::resized()
+{
+    juce_free (history);
+    historySize = jmax (1, getWidth());
+    historyPos = 0;
+    history = (kittyScopeCollector::Column*) juce_calloc (sizeof (kittyScopeCollector::Column) * historySize);
+}
+
+void kittyScope::timerCallback()
+{
+    const int num = collector->readColumns (incoming, kittyScopeCollector::fifoSize);
+
+    if (num == 0 || history == 0)
+        return;
+
+    // if more arrived than will fit on screen, only the newest ones matter
+    const int first = jmax (0, num - historySize);
+
+    for (int i = first; i < num; ++i)
+    {
+        history [historyPos] = incoming[i];
+
+        if (++historyPos >= historySize)
+            historyPos = 0;
+    }
+
+    repaint();
+}
+
+void kittyScope::paint (Graphics& g)
+{
+    g.fillAll (Colour (0xff202020));
+
+    const float mid = getHeight() * 0.5f;
+    const float scale = mid - 1.0f;
+
+    g.setColour (Colour (0xff404040));
+    g.drawHorizontalLine ((int) mid, 0.0f, (float) getWidth());
+
+    if (history == 0)
+        return;
+
+    const Colour inColour (0x90169e1d), outColour (0xffd35a77);
+
+    for (int x = 0; x < historySize; ++x)
+    {
+        const kittyScopeCollector::Column& c = history [(historyPos + x) % historySize];
+
+        // (a column's range is drawn at least one pixel high, so flat steps still show)
+        g.setColour (inColour);
+        g.drawVerticalLine (x, mid - scale * jlimit (-1.0f, 1.0f, c.inMax),
+                            mid - scale * jlimit (-1.0f, 1.0f, c.inMin) + 1.0f);
+
+        g.setColour (outColour);
+        g.drawVerticalLine (x, mid - scale * jlimit (-1.0f, 1.0f, c.outMax),
+                            mid - scale * jlimit (-1.0f, 1.0f, c.outMin) + 1.0f);
+    }
+}
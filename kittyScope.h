@@ -0,0 +1,113 @@
+#ifndef KITTYSCOPE_H
+#define KITTYSCOPE_H
+
+#include <juce.h>
+#include "wrapper/juce_LockFreeFifo.h"
+
+class kitty;
+
+//==============================================================================
+/**
+    Boils the audio down into min/max columns for the editor's scope.
+
+    The audio thread calls addInput() with a block before it's decimated and
+    addOutput() with the same block afterwards, and each run of samplesPerColumn
+    samples becomes one column holding the range of the input and of the output.
+    Finished columns go into a fixed-size single-reader/single-writer fifo, and
+    if the editor isn't reading them fast enough, new ones are just dropped.
+
+    Nothing is done at all unless a scope has called setActive (true), and the
+    filter only creates one of these while a scope is showing.
+*/
+class kittyScopeCollector
+{
+public:
+    kittyScopeCollector();
+    ~kittyScopeCollector();
+
+    enum
+    {
+        samplesPerColumn = 4,
+        maxColumnsPerBlock = 2048,  // (the tail of any bigger block isn't shown)
+        fifoSize = 8192
+    };
+
+    struct Column
+    {
+        float inMin, inMax, outMin, outMax;
+    };
+
+    //==============================================================================
+    /** Turns the collector on or off. Call this from the message thread. */
+    void setActive (const bool shouldBeActive) throw();
+    bool isActive() const throw()                   { return active != 0; }
+
+    /** Audio thread: reduces a block before processing. */
+    void addInput (const float* samples, int numSamples) throw();
+
+    /** Audio thread: reduces the same block after processing, and publishes the columns. */
+    void addOutput (const float* samples, int numSamples) throw();
+
+    /** Message thread: copies out up to maxColumns of the waiting columns, oldest first,
+        and returns the number copied.
+    */
+    int readColumns (Column* dest, int maxColumns) throw();
+
+    juce_UseDebuggingNewOperator
+
+private:
+    struct PartialColumn
+    {
+        float lo, hi;
+        int numSamples;
+    };
+
+    Column columns [fifoSize];
+    LockFreeFifo fifo;
+    volatile int active;
+
+    float inMins [maxColumnsPerBlock], inMaxs [maxColumnsPerBlock];
+    float outMins [maxColumnsPerBlock], outMaxs [maxColumnsPerBlock];
+    PartialColumn partialIn, partialOut;
+    int numInputColumns;
+
+    static int reduce (const float* samples, int numSamples, PartialColumn& partial,
+                       float* mins, float* maxs) throw();
+
+    kittyScopeCollector (const kittyScopeCollector&);
+    const kittyScopeCollector& operator= (const kittyScopeCollector&);
+};
+
+//==============================================================================
+/**
+    Draws the input and decimated output from a kittyScopeCollector, scrolling
+    from right to left.
+
+    It asks the filter for a collector when it's created, polls it at a fixed
+    frame rate, and gives it back when it's deleted. It only repaints its own area.
+*/
+class kittyScope  : public Component,
+                    public Timer
+{
+public:
+    kittyScope (kitty& owner);
+    ~kittyScope();
+
+    void paint (Graphics& g);
+    void resized();
+    void timerCallback();
+
+    juce_UseDebuggingNewOperator
+
+private:
+    kitty& owner;
+    kittyScopeCollector* collector;
+    kittyScopeCollector::Column* history;
+    kittyScopeCollector::Column* incoming;
+    int historySize, historyPos;
+
+    kittyScope (const kittyScope&);
+    const kittyScope& operator= (const kittyScope&);
+};
+
+#endif
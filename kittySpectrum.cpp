@@ -0,0 +1,315 @@
+#include "kittySpectrum.h"
+#include "kitty.h"
+
+//==============================================================================
+kittySpectrumCollector::kittySpectrumCollector()
+    : fifo (fifoSize),
+      active (0),
+      start1 (0),
+      size1 (0),
+      start2 (0),
+      size2 (0)
+{
+}
+
+kittySpectrumCollector::~kittySpectrumCollector()
+{
+}
+
+void kittySpectrumCollector::setActive (const bool shouldBeActive) throw()
+{
+    active = shouldBeActive ? 1 : 0;
+}
+
+void kittySpectrumCollector::addInput (const float* samples, int numSamples) throw()
+{
+    fifo.prepareToWrite (numSamples, start1, size1, start2, size2);
+
+    // if the analyser's fallen behind, skip the whole block rather than leave a gap in the middle of one
+    if (size1 + size2 < numSamples)
+    {
+        size1 = size2 = 0;
+        return;
+    }
+
+    memcpy (inSamples + start1, samples, sizeof (float) * size1);
+
+    if (size2 > 0)
+        memcpy (inSamples + start2, samples + size1, sizeof (float) * size2);
+}
+
+void kittySpectrumCollector::addOutput (const float* samples, int numSamples) throw()
+{
+    // (this has to be the same block that was just given to addInput())
+    jassert (size1 + size2 == 0 || size1 + size2 == numSamples);
+
+    if (size1 + size2 == 0)
+        return;
+
+    memcpy (outSamples + start1, samples, sizeof (float) * size1);
+
+    if (size2 > 0)
+        memcpy (outSamples + start2, samples + size1, sizeof (float) * size2);
+
+    fifo.finishedWrite (size1 + size2);
+    size1 = size2 = 0;
+}
+
+int kittySpectrumCollector::readSamples (float* inDest, float* outDest, int maxSamples) throw()
+{
+    int s1, n1, s2, n2;
+    fifo.prepareToRead (maxSamples, s1, n1, s2, n2);
+
+    if (n1 > 0)
+    {
+        memcpy (inDest, inSamples + s1, sizeof (float) * n1);
+        memcpy (outDest, outSamples + s1, sizeof (float) * n1);
+    }
+
+    if (n2 > 0)
+    {
+        memcpy (inDest + n1, inSamples + s2, sizeof (float) * n2);
+        memcpy (outDest + n1, outSamples + s2, sizeof (float) * n2);
+    }
+
+    fifo.finishedRead (n1 + n2);
+    return n1 + n2;
+}
+
+//==============================================================================
+static const float minDecibels = -96.0f;
+static const float decibelsFallPerFrame = 1.5f;
+
+kittySpectrumAnalyser::kittySpectrumAnalyser (kitty& owner_)
+    : Thread (T("kitty spectrum")),
+      owner (owner_),
+      collector (0),
+      numInFrame (0),
+      spectraChanged (false)
+{
+    int i;
+    for (i = 0; i < fftSize; ++i)
+        window[i] = (float) (0.5 - 0.5 * cos (2.0 * double_Pi * i / fftSize));
+
+    for (i = 0; i < fftSize / 2; ++i)
+    {
+        cosTable[i] = (float) cos (2.0 * double_Pi * i / fftSize);
+        sinTable[i] = (float) -sin (2.0 * double_Pi * i / fftSize);
+    }
+
+    for (i = 0; i < fftSize; ++i)
+    {
+        int r = 0;
+
+        for (int bit = 0; bit < fftOrder; ++bit)
+            if ((i & (1 << bit)) != 0)
+                r |= 1 << (fftOrder - 1 - bit);
+
+        bitReversed[i] = r;
+    }
+
+    for (i = 0; i < numBins; ++i)
+        inSpectrum[i] = outSpectrum[i] = minDecibels;
+}
+
+kittySpectrumAnalyser::~kittySpectrumAnalyser()
+{
+    stop();
+}
+
+void kittySpectrumAnalyser::start()
+{
+    if (collector != 0)
+        return;
+
+    numInFrame = 0;
+    collector = &owner.createSpectrumCollector();
+    collector->setActive (true);
+    startThread (3);
+}
+
+void kittySpectrumAnalyser::stop()
+{
+    if (collector == 0)
+        return;
+
+    collector->setActive (false);
+    stopThread (2000);
+
+    owner.releaseSpectrumCollector();
+    collector = 0;
+}
+
+bool kittySpectrumAnalyser::getSpectra (float* inDecibels, float* outDecibels)
+{
+    const ScopedLock sl (spectraLock);
+
+    if (! spectraChanged)
+        return false;
+
+    memcpy (inDecibels, inSpectrum, sizeof (inSpectrum));
+    memcpy (outDecibels, outSpectrum, sizeof (outSpectrum));
+    spectraChanged = false;
+    return true;
+}
+
+void kittySpectrumAnalyser::run()
+{
+    while (! threadShouldExit())
+    {
+        const int num = collector->readSamples (inFrame + numInFrame, outFrame + numInFrame,
+                                                fftSize - numInFrame);
+        numInFrame += num;
+
+        if (numInFrame == fftSize)
+        {
+            analyseFrame();
+
+            // frames overlap by half, so keep the newer half for the next one
+            memmove (inFrame, inFrame + hopSize, sizeof (float) * (fftSize - hopSize));
+            memmove (outFrame, outFrame + hopSize, sizeof (float) * (fftSize - hopSize));
+            numInFrame = fftSize - hopSize;
+        }
+        else if (num == 0)
+        {
+            wait (20);
+        }
+    }
+}
+
+void kittySpectrumAnalyser::analyseFrame()
+{
+    // both signals are real, so they go through one complex fft together, the
+    // input as the real part and the output as the imaginary part
+    for (int i = 0; i < fftSize; ++i)
+    {
+        const int j = bitReversed[i];
+        re[j] = inFrame[i] * window[i];
+        im[j] = outFrame[i] * window[i];
+    }
+
+    performFFT();
+
+    // (a full-scale sine comes out at fftSize / 4 with a hann window)
+    const float scale = 16.0f / ((float) fftSize * (float) fftSize);
+
+    const ScopedLock sl (spectraLock);
+
+    for (int k = 0; k < numBins; ++k)
+    {
+        // ...and are pulled apart again using the symmetry of each one's spectrum
+        const int nk = (fftSize - k) & (fftSize - 1);
+        const float a = re[k], b = im[k], c = re[nk], d = im[nk];
+
+        const float inPower = ((a + c) * (a + c) + (b - d) * (b - d)) * 0.25f * scale;
+        const float outPower = ((b + d) * (b + d) + (a - c) * (a - c)) * 0.25f * scale;
+
+        const float inDb = jmax (minDecibels, 10.0f * (float) log10 (inPower + 1.0e-12f));
+        const float outDb = jmax (minDecibels, 10.0f * (float) log10 (outPower + 1.0e-12f));
+
+        inSpectrum[k] = jmax (inDb, inSpectrum[k] - decibelsFallPerFrame);
+        outSpectrum[k] = jmax (outDb, outSpectrum[k] - decibelsFallPerFrame);
+    }
+
+    spectraChanged = true;
+}
+
+void kittySpectrumAnalyser::performFFT() throw()
+{
+    // in-place radix-2, with the input already in bit-reversed order
+    for (int size = 2; size <= fftSize; size <<= 1)
+    {
+        const int half = size >> 1;
+        const int tableStep = fftSize / size;
+
+        for (int i = 0; i < fftSize; i += size)
+        {
+            for (int j = 0; j < half; ++j)
+            {
+                const float wr = cosTable [j * tableStep];
+                const float wi = sinTable [j * tableStep];
+
+                const int p = i + j, q = p + half;
+                const float tr = re[q] * wr - im[q] * wi;
+                const float ti = re[q] * wi + im[q] * wr;
+
+                re[q] = re[p] - tr;
+                im[q] = im[p] - ti;
+                re[p] += tr;
+                im[p] += ti;
+            }
+        }
+    }
+}
+
+//==============================================================================
+kittySpectrum::kittySpectrum (kitty& owner)
+    : Component (T("Spectrum")),
+      analyser (owner),
+      foldingPoint (1.0f)
+{
+    setOpaque (true);
+
+    for (int i = 0; i < kittySpectrumAnalyser::numBins; ++i)
+        inDecibels[i] = outDecibels[i] = minDecibels;
+
+    analyser.start();
+    startTimer (1000 / 30);
+}
+
+kittySpectrum::~kittySpectrum()
+{
+    stopTimer();
+    analyser.stop();
+}
+
+void kittySpectrum::setFoldingPoint (const float proportionOfNyquist)
+{
+    if (foldingPoint != proportionOfNyquist)
+    {
+        foldingPoint = proportionOfNyquist;
+        repaint();
+    }
+}
+
+void kittySpectrum::timerCallback()
+{
+    if (analyser.getSpectra (inDecibels, outDecibels))
+        repaint();
+}
+
+void kittySpectrum::paint (Graphics& g)
+{
+    g.fillAll (Colour (0xff202020));
+
+    const int w = getWidth(), h = getHeight();
+    const float dbToY = (h - 1) / minDecibels;
+
+    // the reduced rate's nyquist - everything in the output above this has folded
+    // back from below it
+    g.setColour (Colour (0xff404040));
+    g.drawVerticalLine (roundFloatToInt (jlimit (0.0f, 1.0f, foldingPoint) * (w - 1)), 0.0f, (float) h);
+
+    const Colour inColour (0x90169e1d), outColour (0xffd35a77);
+
+    for (int x = 0; x < w; ++x)
+    {
+        // each column shows the loudest of the bins under it
+        const int firstBin = x * kittySpectrumAnalyser::numBins / w;
+        const int endBin = jmax (firstBin + 1, (x + 1) * kittySpectrumAnalyser::numBins / w);
+
+        float inDb = minDecibels, outDb = minDecibels;
+
+        for (int i = firstBin; i < endBin; ++i)
+        {
+            inDb = jmax (inDb, inDecibels[i]);
+            outDb = jmax (outDb, outDecibels[i]);
+        }
+
+        g.setColour (inColour);
+        g.drawVerticalLine (x, inDb * dbToY, (float) h);
+
+        g.setColour (outColour);
+        g.drawVerticalLine (x, outDb * dbToY, outDb * dbToY + 2.0f);
+    }
+}
@@ -0,0 +1,157 @@
+#ifndef KITTYSPECTRUM_H
+#define KITTYSPECTRUM_H
+
+#include <juce.h>
+#include "wrapper/juce_LockFreeFifo.h"
+
+class kitty;
+
+//==============================================================================
+/**
+    Passes the raw audio from the audio thread over to a kittySpectrumAnalyser.
+
+    Like the scope's collector, addInput() is called with a block before it's
+    decimated and addOutput() with the same block afterwards, but here the
+    samples are just copied into a fixed-size single-reader/single-writer fifo
+    and all the work happens on the analyser's thread.
+
+    A block only goes in if there's room for all of it, so the analyser never
+    sees half a block, and nothing is copied at all unless an analyser is running.
+    The filter only creates one of these while an analyser's running, too.
+*/
+class kittySpectrumCollector
+{
+public:
+    kittySpectrumCollector();
+    ~kittySpectrumCollector();
+
+    enum
+    {
+        fifoSize = 16384
+    };
+
+    //==============================================================================
+    /** Turns the collector on or off. Only the analyser calls this. */
+    void setActive (const bool shouldBeActive) throw();
+    bool isActive() const throw()                   { return active != 0; }
+
+    /** Audio thread: copies a block before processing. */
+    void addInput (const float* samples, int numSamples) throw();
+
+    /** Audio thread: copies the same block after processing, and publishes both. */
+    void addOutput (const float* samples, int numSamples) throw();
+
+    /** Analyser thread: copies out up to maxSamples of the waiting input and output
+        samples, oldest first, and returns the number copied.
+    */
+    int readSamples (float* inDest, float* outDest, int maxSamples) throw();
+
+    juce_UseDebuggingNewOperator
+
+private:
+    float inSamples [fifoSize], outSamples [fifoSize];
+    LockFreeFifo fifo;
+    volatile int active;
+    int start1, size1, start2, size2;
+
+    kittySpectrumCollector (const kittySpectrumCollector&);
+    const kittySpectrumCollector& operator= (const kittySpectrumCollector&);
+};
+
+//==============================================================================
+/**
+    A background thread that takes windowed FFTs of the samples from a
+    kittySpectrumCollector, and keeps a smoothed spectrum of the input and the
+    output for a display to pick up.
+
+    The filter's collector is created and switched on when the thread starts, and
+    switched off and deleted when it stops, so while no analyser is running, the
+    audio thread doesn't do anything extra and the fifo takes up no memory.
+*/
+class kittySpectrumAnalyser  : public Thread
+{
+public:
+    kittySpectrumAnalyser (kitty& owner);
+    ~kittySpectrumAnalyser();
+
+    enum
+    {
+        fftOrder = 10,
+        fftSize = 1 << fftOrder,
+        numBins = fftSize / 2,
+        hopSize = fftSize / 2
+    };
+
+    /** Starts analysing. */
+    void start();
+
+    /** Stops the thread, and gives the collector back to the filter. */
+    void stop();
+
+    /** Copies the latest spectra, in decibels, into two arrays of numBins values.
+        Returns false if nothing has been analysed since the last call.
+    */
+    bool getSpectra (float* inDecibels, float* outDecibels);
+
+    void run();
+
+    juce_UseDebuggingNewOperator
+
+private:
+    kitty& owner;
+    kittySpectrumCollector* collector;
+
+    float inFrame [fftSize], outFrame [fftSize];
+    int numInFrame;
+
+    float window [fftSize];
+    float re [fftSize], im [fftSize];
+    float cosTable [fftSize / 2], sinTable [fftSize / 2];
+    int bitReversed [fftSize];
+
+    CriticalSection spectraLock;
+    float inSpectrum [numBins], outSpectrum [numBins];
+    bool spectraChanged;
+
+    void analyseFrame();
+    void performFFT() throw();
+
+    kittySpectrumAnalyser (const kittySpectrumAnalyser&);
+    const kittySpectrumAnalyser& operator= (const kittySpectrumAnalyser&);
+};
+
+//==============================================================================
+/**
+    Draws the input and decimated output spectra on a linear frequency scale, so
+    that the images folding back around the reduced rate line up with the ones
+    above it.
+
+    It runs its own kittySpectrumAnalyser for as long as it's on screen.
+*/
+class kittySpectrum  : public Component,
+                       public Timer
+{
+public:
+    kittySpectrum (kitty& owner);
+    ~kittySpectrum();
+
+    /** Sets where to mark the reduced sample rate's nyquist frequency, as a
+        proportion of the host's.
+    */
+    void setFoldingPoint (const float proportionOfNyquist);
+
+    void paint (Graphics& g);
+    void timerCallback();
+
+    juce_UseDebuggingNewOperator
+
+private:
+    kittySpectrumAnalyser analyser;
+    float inDecibels [kittySpectrumAnalyser::numBins], outDecibels [kittySpectrumAnalyser::numBins];
+    float foldingPoint;
+
+    kittySpectrum (const kittySpectrum&);
+    const kittySpectrum& operator= (const kittySpectrum&);
+};
+
+#endif
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+    kittyArtworkPixels - regenerates kittyArtwork.cpp from the png that the
+    Jucer embeds in kittyEditor.cpp.
+
+    usage: python3 tools/kittyArtworkPixels.py   (from the top of the tree)
+
+    The editor draws its artwork from these pixels rather than decoding the
+    png, so run this again whenever the Jucer's copy of the png changes. The
+    pixels are premultiplied ARGB, rounded the same way as juce's png loader.
+"""
+
+import re
+import struct
+import zlib
+
+def read_embedded_png (path):
+    source = open (path).read()
+    match = re.search (r'resource_kittyEditor_kitty_png\[\] = \{(.*?)\};', source, re.S)
+    return bytes (int (x) for x in match.group (1).split (',') if x.strip())
+
+def decode_rgba (png):
+    assert png[:8] == b'\x89PNG\r\n\x1a\n'
+    pos, data = 8, b''
+
+    while True:
+        length, kind = struct.unpack ('>I4s', png[pos:pos + 8])
+        body = png[pos + 8:pos + 8 + length]
+        pos += 12 + length
+
+        if kind == b'IHDR':
+            width, height, depth, colourType, _, _, interlace = struct.unpack ('>IIBBBBB', body)
+            assert depth == 8 and colourType == 6 and interlace == 0, 'only 8-bit rgba is handled'
+        elif kind == b'IDAT':
+            data += body
+        elif kind == b'IEND':
+            break
+
+    raw = zlib.decompress (data)
+    stride = width * 4
+    rows, previous, pos = [], bytearray (stride), 0
+
+    for y in range (height):
+        filterType = raw[pos]
+        line = bytearray (raw[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+
+        for i in range (stride):
+            left = line[i - 4] if i >= 4 else 0
+            up = previous[i]
+            upLeft = previous[i - 4] if i >= 4 else 0
+
+            if filterType == 1:
+                line[i] = (line[i] + left) & 0xff
+            elif filterType == 2:
+                line[i] = (line[i] + up) & 0xff
+            elif filterType == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xff
+            elif filterType == 4:
+                p = left + up - upLeft
+                pa, pb, pc = abs (p - left), abs (p - up), abs (p - upLeft)
+                predictor = left if (pa <= pb and pa <= pc) else (up if pb <= pc else upLeft)
+                line[i] = (line[i] + predictor) & 0xff
+
+        rows.append (line)
+        previous = line
+
+    return width, height, rows
+
+def premultiplied_argb (r, g, b, a):
+    if a == 0:
+        return 0
+
+    if a < 0xff:
+        r, g, b = [(c * a + 0x7f) >> 8 for c in (r, g, b)]
+
+    return (a << 24) | (r << 16) | (g << 8) | b
+
+def main():
+    width, height, rows = decode_rgba (read_embedded_png ('kittyEditor.cpp'))
+    pixels = []
+
+    for line in rows:
+        for x in range (width):
+            pixels.append (premultiplied_argb (*line[x * 4:x * 4 + 4]))
+
+    out = open ('kittyArtwork.cpp', 'w', newline='\n')
+    out.write ('// generated from the png in kittyEditor.cpp by tools/kittyArtworkPixels.py - don\'t edit\n\n')
+    out.write ('#include "kittyArtwork.h"\n\n')
+    out.write ('const uint32 kittyArtworkPixels [kittyArtworkWidth * kittyArtworkHeight] =\n{\n')
+
+    for i in range (0, len (pixels), 8):
+        out.write ('    ' + ', '.join ('0x%08x' % p for p in pixels[i:i + 8]) + ',\n')
+
+    out.write ('};\n')
+
+if __name__ == '__main__':
+    main()
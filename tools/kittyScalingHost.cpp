@@ -0,0 +1,453 @@
+/*
+    kittyScalingHost - simulates a big session: N instances of the plugin,
+    processed by a pool of worker threads the way a host's graph scheduler
+    does it.
+
+    usage: kittyScalingHost <plugin.so> [--instances 1,16,128,500] [--threads 1,2,4,8,16,32]
+                            [--rate 48000] [--block 128] [--cycles 2000]
+                            [--pin] [--parallel-create]
+
+    Each "cycle" is one audio period: every instance must have its
+    processReplacing() called once, and the cycle has to finish inside
+    block / rate seconds. The workers pull instances off a shared counter,
+    so load balances itself, and a barrier ends each cycle.
+
+    For every instance count and thread count it reports the throughput,
+    the per-call and per-cycle tail latencies, and how much slower each call
+    gets compared to running single-threaded. A call that gets slower as
+    threads are added (when there are enough cores) means the instances are
+    contending for something global - a lock, a shared cache line, or the
+    allocator. A call that gets slower as instances are added points at
+    something that scans the list of instances.
+
+    --parallel-create also creates the instances from all the worker threads
+    at once, which is what hosts that load projects in parallel do. Plugins
+    whose instantiation isn't thread-safe may crash here.
+*/
+
+#include "kittyVstHost.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+//==============================================================================
+static std::vector<int> parseList (const char* text)
+{
+    std::vector<int> values;
+
+    while (text != 0 && *text != 0)
+    {
+        const int v = atoi (text);
+
+        if (v > 0)
+            values.push_back (v);
+
+        text = strchr (text, ',');
+
+        if (text != 0)
+            ++text;
+    }
+
+    return values;
+}
+
+static const char* getOption (int argc, char* argv[], const char* name, const char* defaultValue)
+{
+    for (int i = 2; i < argc - 1; ++i)
+        if (strcmp (argv[i], name) == 0)
+            return argv [i + 1];
+
+    return defaultValue;
+}
+
+static bool hasFlag (int argc, char* argv[], const char* name)
+{
+    for (int i = 2; i < argc; ++i)
+        if (strcmp (argv[i], name) == 0)
+            return true;
+
+    return false;
+}
+
+static void pinCurrentThreadToCpu (int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO (&set);
+    CPU_SET (cpu % CPU_SETSIZE, &set);
+    pthread_setaffinity_np (pthread_self(), sizeof (set), &set);
+}
+
+//==============================================================================
+/** One plugin instance plus the buffers the host has allocated for it. */
+struct Node
+{
+    Node (const VstPluginModule& module)
+        : plugin (module)
+    {
+    }
+
+    void prepare (double sampleRate, int blockSize)
+    {
+        plugin.open (sampleRate, blockSize);
+        plugin.resume();
+
+        const int numChans = std::max (plugin.getNumInputs(), plugin.getNumOutputs());
+
+        inputData.assign (numChans * blockSize, 0.0f);
+        outputData.assign (numChans * blockSize, 0.0f);
+        inputs.assign (numChans + 1, (float*) 0);
+        outputs.assign (numChans + 1, (float*) 0);
+
+        for (int i = 0; i < numChans; ++i)
+        {
+            inputs[i] = &inputData [i * blockSize];
+            outputs[i] = &outputData [i * blockSize];
+
+            for (int j = 0; j < blockSize; ++j)
+                inputs[i][j] = (float) (0.5 * sin ((j + i * 13) * 0.05));
+        }
+    }
+
+    VstHostedPlugin plugin;
+    std::vector<float> inputData, outputData;
+    std::vector<float*> inputs, outputs;
+    int64_t createTime;
+};
+
+//==============================================================================
+class GraphSimulation
+{
+public:
+    GraphSimulation (std::vector<Node*>& nodes_, int numThreads_, int blockSize_, int numCycles_, bool pinThreads_)
+        : nodes (nodes_),
+          numThreads (numThreads_),
+          blockSize (blockSize_),
+          numCycles (numCycles_),
+          pinThreads (pinThreads_),
+          nextNode (0),
+          quit (false)
+    {
+        pthread_barrier_init (&cycleStart, 0, numThreads);
+        pthread_barrier_init (&cycleEnd, 0, numThreads);
+
+        cycleTimes.reserve (numCycles);
+
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            nodes[i]->plugin.processReplacingTimes.clear();
+            nodes[i]->plugin.processReplacingTimes.reserve (numCycles);
+        }
+    }
+
+    ~GraphSimulation()
+    {
+        pthread_barrier_destroy (&cycleStart);
+        pthread_barrier_destroy (&cycleEnd);
+    }
+
+    void run()
+    {
+        std::vector<pthread_t> threads (numThreads);
+        std::vector<WorkerArgs> args (numThreads);
+
+        // thread 0 is this one, which also times the cycles
+        for (int i = 1; i < numThreads; ++i)
+        {
+            args[i].owner = this;
+            args[i].index = i;
+            pthread_create (&threads[i], 0, &workerThreadEntry, &args[i]);
+        }
+
+        if (pinThreads)
+            pinCurrentThreadToCpu (0);
+
+        for (int cycle = 0; cycle < numCycles; ++cycle)
+        {
+            const int64_t start = vstHostNanoseconds();
+
+            nextNode = 0;
+            pthread_barrier_wait (&cycleStart);
+            processNodes();
+            pthread_barrier_wait (&cycleEnd);
+
+            cycleTimes.add (vstHostNanoseconds() - start);
+        }
+
+        quit = true;
+        pthread_barrier_wait (&cycleStart);
+
+        for (int i = 1; i < numThreads; ++i)
+            pthread_join (threads[i], 0);
+    }
+
+    VstCallTimings cycleTimes;
+
+private:
+    std::vector<Node*>& nodes;
+    const int numThreads, blockSize, numCycles;
+    const bool pinThreads;
+    volatile int nextNode;
+    volatile bool quit;
+    pthread_barrier_t cycleStart, cycleEnd;
+
+    struct WorkerArgs
+    {
+        GraphSimulation* owner;
+        int index;
+    };
+
+    static void* workerThreadEntry (void* p)
+    {
+        WorkerArgs* const args = (WorkerArgs*) p;
+        args->owner->workerThread (args->index);
+        return 0;
+    }
+
+    void workerThread (int index)
+    {
+        if (pinThreads)
+            pinCurrentThreadToCpu (index);
+
+        for (;;)
+        {
+            pthread_barrier_wait (&cycleStart);
+
+            if (quit)
+                break;
+
+            processNodes();
+            pthread_barrier_wait (&cycleEnd);
+        }
+    }
+
+    void processNodes()
+    {
+        const int numNodes = (int) nodes.size();
+
+        for (;;)
+        {
+            const int index = __sync_fetch_and_add (&nextNode, 1);
+
+            if (index >= numNodes)
+                break;
+
+            Node* const n = nodes [index];
+            n->plugin.processReplacing (&n->inputs[0], &n->outputs[0], blockSize);
+        }
+    }
+};
+
+//==============================================================================
+/** Creates instances, optionally from several threads at once. */
+class NodeFactory
+{
+public:
+    NodeFactory (const VstPluginModule& module_, std::vector<Node*>& nodes_, int numToCreate_)
+        : module (module_),
+          nodes (nodes_),
+          numToCreate (numToCreate_),
+          nextIndex (0)
+    {
+        nodes.assign (numToCreate, (Node*) 0);
+    }
+
+    void create (int numThreads)
+    {
+        std::vector<pthread_t> threads (numThreads);
+
+        for (int i = 1; i < numThreads; ++i)
+            pthread_create (&threads[i], 0, &threadEntry, this);
+
+        createNodes();
+
+        for (int i = 1; i < numThreads; ++i)
+            pthread_join (threads[i], 0);
+    }
+
+private:
+    const VstPluginModule& module;
+    std::vector<Node*>& nodes;
+    const int numToCreate;
+    volatile int nextIndex;
+
+    static void* threadEntry (void* p)
+    {
+        ((NodeFactory*) p)->createNodes();
+        return 0;
+    }
+
+    void createNodes()
+    {
+        for (;;)
+        {
+            const int index = __sync_fetch_and_add (&nextIndex, 1);
+
+            if (index >= numToCreate)
+                break;
+
+            const int64_t start = vstHostNanoseconds();
+            Node* const n = new Node (module);
+            n->createTime = vstHostNanoseconds() - start;
+
+            nodes [index] = n;
+        }
+    }
+};
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        printf ("usage: %s <plugin.so> [--instances 1,16,128,500] [--threads 1,2,4,8,16,32]\n"
+                "       [--rate 48000] [--block 128] [--cycles 2000] [--pin] [--parallel-create]\n", argv[0]);
+        return 2;
+    }
+
+    const std::vector<int> instanceCounts (parseList (getOption (argc, argv, "--instances", "1,16,128,500")));
+    const std::vector<int> threadCounts (parseList (getOption (argc, argv, "--threads", "1,2,4,8,16,32")));
+    const double sampleRate = atof (getOption (argc, argv, "--rate", "48000"));
+    const int blockSize = std::max (1, atoi (getOption (argc, argv, "--block", "128")));
+    const int numCycles = std::max (10, atoi (getOption (argc, argv, "--cycles", "2000")));
+    const bool pinThreads = hasFlag (argc, argv, "--pin");
+    const bool parallelCreate = hasFlag (argc, argv, "--parallel-create");
+
+    if (instanceCounts.empty() || threadCounts.empty())
+    {
+        printf ("need at least one instance count and one thread count\n");
+        return 2;
+    }
+
+    VstPluginModule module;
+    std::string error;
+
+    if (! module.load (argv[1], error))
+    {
+        printf ("couldn't load %s: %s\n", argv[1], error.c_str());
+        return 2;
+    }
+
+    const double deadline = 1.0e9 * blockSize / sampleRate;
+    const int maxThreads = *std::max_element (threadCounts.begin(), threadCounts.end());
+
+    printf ("%d cycles of %d samples at %.0f Hz, cycle deadline %.1f us, %ld cpus online\n",
+            numCycles, blockSize, sampleRate, deadline * 0.001, sysconf (_SC_NPROCESSORS_ONLN));
+
+    std::vector<double> singleThreadCallCost;   // mean call time at the lowest thread count, per instance count
+
+    for (size_t n = 0; n < instanceCounts.size(); ++n)
+    {
+        const int numInstances = instanceCounts[n];
+        std::vector<Node*> nodes;
+
+        //==============================================================================
+        const int64_t createStart = vstHostNanoseconds();
+        NodeFactory (module, nodes, numInstances).create (parallelCreate ? maxThreads : 1);
+        const int64_t createTotal = vstHostNanoseconds() - createStart;
+
+        VstCallTimings createTimes, openTimes;
+        createTimes.reserve (numInstances);
+        openTimes.reserve (numInstances);
+
+        bool allValid = true;
+        for (int i = 0; i < numInstances; ++i)
+        {
+            if (! nodes[i]->plugin.isValid())
+            {
+                allValid = false;
+                continue;
+            }
+
+            createTimes.add (nodes[i]->createTime);
+            nodes[i]->prepare (sampleRate, blockSize);
+            openTimes.addFrom (nodes[i]->plugin.openTimes);
+        }
+
+        printf ("\n==== %d instances ====\n\n", numInstances);
+
+        if (! allValid)
+        {
+            printf ("some instances failed to create!\n");
+            return 1;
+        }
+
+        // if creating instance #N costs more than instance #1, something's scanning a global list
+        const int64_t firstCreate = nodes.front()->createTime;
+        const int64_t lastCreate = nodes.back()->createTime;
+
+        printf ("instantiation: %.2f ms total, first %.1f us, last %.1f us\n",
+                createTotal * 1.0e-6, firstCreate * 0.001, lastCreate * 0.001);
+        printf ("%s\n", VstCallTimings::getDescriptionHeader().c_str());
+        printf ("%s\n", createTimes.describe ("create", 0).c_str());
+        printf ("%s\n\n", openTimes.describe ("open", 0).c_str());
+
+        printf ("threads   calls/s     realtime  call mean(us)  call p99(us)  cycle p99(us)  cycle p99.9(us)  cycle max(us)  overruns  slowdown\n");
+
+        double baseCallCost = 0.0;
+
+        for (size_t t = 0; t < threadCounts.size(); ++t)
+        {
+            const int numThreads = threadCounts[t];
+
+            // a short warm-up so that first-call work doesn't pollute the figures
+            {
+                GraphSimulation warmUp (nodes, numThreads, blockSize, 8, pinThreads);
+                warmUp.run();
+            }
+
+            GraphSimulation sim (nodes, numThreads, blockSize, numCycles, pinThreads);
+            sim.run();
+
+            VstCallTimings calls;
+            calls.reserve (numInstances * numCycles);
+
+            for (int i = 0; i < numInstances; ++i)
+                calls.addFrom (nodes[i]->plugin.processReplacingTimes);
+
+            const double meanCycle = sim.cycleTimes.getMean();
+            const double callsPerSecond = meanCycle > 0 ? numInstances * 1.0e9 / meanCycle : 0.0;
+            const double meanCall = calls.getMean();
+
+            if (t == 0)
+                baseCallCost = meanCall;
+
+            printf ("%7d %9.0f %11.2fx %14.2f %13.2f %14.1f %16.1f %14.1f %9d %8.2fx\n",
+                    numThreads, callsPerSecond,
+                    meanCycle > 0 ? deadline / meanCycle : 0.0,
+                    meanCall * 0.001,
+                    calls.getPercentile (99.0) * 0.001,
+                    sim.cycleTimes.getPercentile (99.0) * 0.001,
+                    sim.cycleTimes.getPercentile (99.9) * 0.001,
+                    sim.cycleTimes.getMax() * 0.001,
+                    sim.cycleTimes.getNumLongerThan ((int64_t) deadline),
+                    baseCallCost > 0 ? meanCall / baseCallCost : 0.0);
+        }
+
+        singleThreadCallCost.push_back (baseCallCost);
+
+        for (int i = numInstances; --i >= 0;)
+            delete nodes[i];
+    }
+
+    //==============================================================================
+    if (singleThreadCallCost.size() > 1 && singleThreadCallCost.front() > 0)
+    {
+        printf ("\nper-call cost against instance count (lowest thread count):\n");
+
+        for (size_t n = 0; n < singleThreadCallCost.size(); ++n)
+            printf ("  %6d instances: %8.2f us  (%.2fx)\n",
+                    instanceCounts[n], singleThreadCallCost[n] * 0.001,
+                    singleThreadCallCost[n] / singleThreadCallCost.front());
+    }
+
+    printf ("\nslowdown is each call's mean time relative to the first thread count. Values well\n"
+            "above 1 with spare cores mean the instances are contending for shared state.\n");
+
+    return 0;
+}
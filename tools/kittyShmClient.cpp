@@ -0,0 +1,330 @@
+/*
+    kittyShmClient - drives the standalone's shared memory device from
+    another process, the way an audio server or a host would.
+
+    usage: kittyShmClient [--name /kitty] [--seconds 10] [--tone 440] [--realtime]
+                          [--output file.raw] [--cpu n] [--fifo priority]
+
+    Start the standalone with "--shm" first (or straight afterwards - this
+    waits a few seconds for the segment to appear). It attaches to the
+    segment, takes the rate, block size and channel layout from it, and then
+    for each block writes a tone into the input ring, waits for the device to
+    hand back the output, and reads it. Without --realtime it goes as fast as
+    the device can keep up, which measures the IPC overhead; with it, blocks
+    are sent at the sample rate, as a sound card driver would.
+
+    It reports the round trip for each block (from publishing the input to
+    the output being ready), how many blocks came back later than a block
+    period, and the output's peak level. --output saves what came back as
+    interleaved 32-bit floats.
+
+    The exit code is 0 if it ran to the end, 1 if the device went away, and
+    2 if it couldn't attach.
+
+    Build with something like:
+
+        g++ -O2 tools/kittyShmClient.cpp -lrt -lpthread -o kittyShmClient
+*/
+
+#include "../wrapper/formats/Standalone/juce_SharedMemoryAudioProtocol.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+//==============================================================================
+static const char* getOption (int argc, char* argv[], const char* name, const char* defaultValue)
+{
+    for (int i = 1; i < argc - 1; ++i)
+        if (strcmp (argv[i], name) == 0)
+            return argv [i + 1];
+
+    return defaultValue;
+}
+
+static bool hasFlag (int argc, char* argv[], const char* name)
+{
+    for (int i = 1; i < argc; ++i)
+        if (strcmp (argv[i], name) == 0)
+            return true;
+
+    return false;
+}
+
+static int64_t nanoseconds()
+{
+    timespec t;
+    clock_gettime (CLOCK_MONOTONIC, &t);
+    return ((int64_t) t.tv_sec) * 1000000000 + t.tv_nsec;
+}
+
+static void sleepUntil (int64_t due)
+{
+    timespec t;
+    t.tv_sec = (time_t) (due / 1000000000);
+    t.tv_nsec = (long) (due % 1000000000);
+
+    while (clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, &t, 0) == EINTR)
+    {}
+}
+
+//==============================================================================
+/** Maps the segment, once the device has created it and filled in its header. */
+static SharedAudioHeader* attach (const char* name, unsigned int& size)
+{
+    for (int attempt = 0; attempt < 100; ++attempt)
+    {
+        const int handle = shm_open (name, O_RDWR, 0);
+
+        if (handle >= 0)
+        {
+            struct stat info;
+
+            if (fstat (handle, &info) == 0 && info.st_size >= sharedAudioHeaderSize)
+            {
+                SharedAudioHeader* h = (SharedAudioHeader*) mmap (0, sharedAudioHeaderSize, PROT_READ | PROT_WRITE,
+                                                                  MAP_SHARED, handle, 0);
+
+                if (h != MAP_FAILED && h->magic == sharedAudioMagic && h->deviceRunning != 0)
+                {
+                    sharedAudioMemoryBarrier();
+
+                    if (h->version != sharedAudioVersion)
+                    {
+                        printf ("%s uses protocol version %u, but this understands version %d\n",
+                                name, h->version, (int) sharedAudioVersion);
+                        munmap (h, sharedAudioHeaderSize);
+                        close (handle);
+                        return 0;
+                    }
+
+                    size = getSharedAudioSegmentSize (h);
+                    munmap (h, sharedAudioHeaderSize);
+
+                    h = (SharedAudioHeader*) mmap (0, size, PROT_READ | PROT_WRITE, MAP_SHARED, handle, 0);
+                    close (handle);
+
+                    return h != MAP_FAILED ? h : 0;
+                }
+
+                if (h != MAP_FAILED)
+                    munmap (h, sharedAudioHeaderSize);
+            }
+
+            close (handle);
+        }
+
+        usleep (50000);
+    }
+
+    return 0;
+}
+
+/** Waits while a counter still has the value given. Returns false if the device stops. */
+static bool waitForChange (SharedAudioHeader* h, volatile unsigned int* counter, unsigned int value)
+{
+    while (*counter == value)
+    {
+        if (h->deviceRunning == 0)
+            return false;
+
+        sharedAudioWait (counter, value, 100);
+    }
+
+    return true;
+}
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    if (hasFlag (argc, argv, "--help"))
+    {
+        printf ("usage: %s [--name /kitty] [--seconds 10] [--tone 440] [--realtime]\n"
+                "       [--output file.raw] [--cpu n] [--fifo priority]\n", argv[0]);
+        return 0;
+    }
+
+    const char* const name = getOption (argc, argv, "--name", "/kitty");
+    const double seconds = atof (getOption (argc, argv, "--seconds", "10"));
+    const double toneFrequency = atof (getOption (argc, argv, "--tone", "440"));
+    const bool realTime = hasFlag (argc, argv, "--realtime");
+    const char* const outputFile = getOption (argc, argv, "--output", 0);
+    const int cpu = atoi (getOption (argc, argv, "--cpu", "-1"));
+    const int fifoPriority = atoi (getOption (argc, argv, "--fifo", "0"));
+
+    unsigned int segmentSize = 0;
+    SharedAudioHeader* const h = attach (name, segmentSize);
+
+    if (h == 0)
+    {
+        printf ("couldn't attach to %s - is the standalone running with --shm?\n", name);
+        return 2;
+    }
+
+    const unsigned int blockSize = h->blockSize;
+    const unsigned int numIns = h->numInputChannels;
+    const unsigned int numOuts = h->numOutputChannels;
+    const double sampleRate = h->sampleRate;
+    const int64_t blockNanos = (int64_t) (1.0e9 * blockSize / sampleRate);
+    const int numBlocks = std::max (1, (int) (seconds * sampleRate / blockSize));
+
+    printf ("attached to %s: %.0f Hz, %u samples per block, %u in, %u out, %u slots, %s\n",
+            name, sampleRate, blockSize, numIns, numOuts, h->numSlots,
+            realTime ? "real-time" : "free-running");
+
+    if (cpu >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO (&set);
+        CPU_SET (cpu % CPU_SETSIZE, &set);
+        pthread_setaffinity_np (pthread_self(), sizeof (set), &set);
+    }
+
+    if (fifoPriority > 0)
+    {
+        sched_param param;
+        memset (&param, 0, sizeof (param));
+        param.sched_priority = fifoPriority;
+
+        if (pthread_setschedparam (pthread_self(), SCHED_FIFO, &param) != 0)
+            printf ("couldn't set SCHED_FIFO - check the rtprio limit\n");
+    }
+
+    FILE* const output = outputFile != 0 ? fopen (outputFile, "wb") : 0;
+    std::vector<float> interleaved (blockSize * std::max (1u, numOuts));
+    std::vector<int64_t> roundTrips;
+    roundTrips.reserve (numBlocks);
+
+    h->clientAttached = 1;
+
+    const double phaseDelta = 2.0 * M_PI * toneFrequency / sampleRate;
+    double phase = 0.0;
+    float peak = 0.0f;
+    int numLate = 0;
+    bool deviceWentAway = false;
+    const int64_t startTime = nanoseconds();
+
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        if (realTime)
+            sleepUntil (startTime + block * blockNanos);
+
+        // wait for a free input slot, which there always will be unless the device has fallen behind
+        const unsigned int blockNumber = h->inputBlocksWritten;
+        unsigned int numRead;
+
+        while (blockNumber - (numRead = h->inputBlocksRead) >= h->numSlots)
+            if (! waitForChange (h, &h->inputBlocksRead, numRead))
+                break;
+
+        if (h->deviceRunning == 0)
+        {
+            deviceWentAway = true;
+            break;
+        }
+
+        for (unsigned int j = 0; j < blockSize; ++j)
+        {
+            const float sample = (float) (0.5 * sin (phase));
+            phase += phaseDelta;
+
+            for (unsigned int i = 0; i < numIns; ++i)
+                getSharedAudioInput (h, blockNumber, i)[j] = sample;
+        }
+
+        phase = fmod (phase, 2.0 * M_PI);
+
+        // publish the block, and wait for the device to send back its output
+        const unsigned int outputBlock = h->outputBlocksRead;
+
+        sharedAudioMemoryBarrier();
+        const int64_t sent = nanoseconds();
+        h->inputBlocksWritten = blockNumber + 1;
+        sharedAudioWake (&h->inputBlocksWritten);
+
+        if (! waitForChange (h, &h->outputBlocksWritten, outputBlock))
+        {
+            deviceWentAway = true;
+            break;
+        }
+
+        const int64_t roundTrip = nanoseconds() - sent;
+        roundTrips.push_back (roundTrip);
+
+        if (roundTrip > blockNanos)
+            ++numLate;
+
+        sharedAudioMemoryBarrier();
+
+        for (unsigned int i = 0; i < numOuts; ++i)
+        {
+            const float* const out = getSharedAudioOutput (h, outputBlock, i);
+
+            for (unsigned int j = 0; j < blockSize; ++j)
+            {
+                peak = std::max (peak, (float) fabs (out[j]));
+                interleaved [j * numOuts + i] = out[j];
+            }
+        }
+
+        if (output != 0 && numOuts > 0)
+            fwrite (&interleaved[0], sizeof (float), blockSize * numOuts, output);
+
+        sharedAudioMemoryBarrier();
+        h->outputBlocksRead = outputBlock + 1;
+        sharedAudioWake (&h->outputBlocksRead);
+    }
+
+    const double wallSeconds = (nanoseconds() - startTime) * 1.0e-9;
+
+    h->clientAttached = 0;
+    munmap (h, segmentSize);
+
+    if (output != 0)
+        fclose (output);
+
+    if (deviceWentAway)
+        printf ("the device stopped after %d blocks\n", (int) roundTrips.size());
+
+    if (! roundTrips.empty())
+    {
+        std::vector<int64_t> sorted (roundTrips);
+        std::sort (sorted.begin(), sorted.end());
+
+        double total = 0;
+
+        for (size_t i = 0; i < sorted.size(); ++i)
+            total += sorted[i];
+
+        const double audioSeconds = sorted.size() * blockSize / sampleRate;
+
+        printf ("blocks: %d, %.2fs of audio in %.2fs, %.1fx real time\n",
+                (int) sorted.size(), audioSeconds, wallSeconds, audioSeconds / std::max (1.0e-9, wallSeconds));
+
+        printf ("round trip (us): mean %.2f, p50 %.2f, p99 %.2f, p99.9 %.2f, max %.2f, block period %.2f\n",
+                total / sorted.size() / 1000.0,
+                sorted [sorted.size() / 2] / 1000.0,
+                sorted [std::min (sorted.size() - 1, sorted.size() * 99 / 100)] / 1000.0,
+                sorted [std::min (sorted.size() - 1, sorted.size() * 999 / 1000)] / 1000.0,
+                sorted.back() / 1000.0,
+                blockNanos / 1000.0);
+
+        printf ("blocks that took longer than a period: %d, output peak %.3f\n", numLate, peak);
+    }
+
+    if (output != 0)
+        printf ("output written to %s\n", outputFile);
+
+    return deviceWentAway ? 1 : 0;
+}
@@ -0,0 +1,300 @@
+/*
+    kittyTestHost - loads a built kitty VST on Linux, runs some regression
+    checks against it and then times a load run.
+
+    usage: kittyTestHost <plugin.so> [--rate 44100] [--block 512] [--blocks 20000]
+
+    The exit code is 0 if every check passed, 1 if a check failed, and 2 if
+    the plugin couldn't be loaded at all.
+*/
+
+#include "kittyVstHost.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+//==============================================================================
+static int numFailures = 0;
+
+static void check (bool condition, const char* what)
+{
+    printf ("  %-52s %s\n", what, condition ? "ok" : "FAILED");
+
+    if (! condition)
+        ++numFailures;
+}
+
+//==============================================================================
+/** A set of de-interleaved channel buffers with a pointer table, as a host would keep. */
+class TestBuffers
+{
+public:
+    TestBuffers (int numChannels_, int numSamples_)
+        : numChannels (numChannels_),
+          numSamples (numSamples_),
+          data (numChannels_ * numSamples_, 0.0f),
+          pointers (numChannels_ + 1, (float*) 0)
+    {
+        for (int i = 0; i < numChannels; ++i)
+            pointers[i] = &data [i * numSamples];
+    }
+
+    float** getArray()                      { return &pointers[0]; }
+    float* getChannel (int channel)         { return pointers [channel]; }
+
+    void fillWithSine (double phase, double increment)
+    {
+        for (int i = 0; i < numChannels; ++i)
+            for (int j = 0; j < numSamples; ++j)
+                pointers[i][j] = (float) (0.8 * sin (phase + (j + i * 7) * increment));
+    }
+
+    void fill (float value)
+    {
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = value;
+    }
+
+    bool isFiniteAndBounded (float limit) const
+    {
+        for (size_t i = 0; i < data.size(); ++i)
+            if (! (data[i] >= -limit && data[i] <= limit))   // also false for NaNs
+                return false;
+
+        return true;
+    }
+
+    float getMaxDifference (const TestBuffers& other) const
+    {
+        float diff = 0.0f;
+
+        for (size_t i = 0; i < data.size() && i < other.data.size(); ++i)
+            diff = std::max (diff, fabsf (data[i] - other.data[i]));
+
+        return diff;
+    }
+
+    const int numChannels, numSamples;
+
+private:
+    std::vector<float> data;
+    std::vector<float*> pointers;
+};
+
+//==============================================================================
+static void runRegressionChecks (VstHostedPlugin& plugin, int blockSize)
+{
+    printf ("\nregression checks:\n");
+
+    const int numIns = plugin.getNumInputs();
+    const int numOuts = plugin.getNumOutputs();
+    const int numParams = plugin.getNumParameters();
+
+    check (plugin.canReplace(), "plugin supports processReplacing");
+
+    // parameters should read back (near enough) what was written
+    bool paramsRoundTrip = true;
+    for (int i = 0; i < numParams; ++i)
+    {
+        const float values[] = { 0.25f, 1.0f, 0.5f };
+
+        for (int j = 0; j < 3; ++j)
+        {
+            plugin.setParameter (i, values[j]);
+
+            if (fabsf (plugin.getParameter (i) - values[j]) > 0.05f)
+                paramsRoundTrip = false;
+        }
+    }
+
+    check (paramsRoundTrip, "setParameter/getParameter round trip");
+
+    // a chunk taken now should restore these values after they've been changed
+    std::vector<float> savedValues;
+    for (int i = 0; i < numParams; ++i)
+        savedValues.push_back (plugin.getParameter (i));
+
+    void* chunkData = 0;
+    const int chunkSize = plugin.getChunk (&chunkData, false);
+    check (chunkSize > 0 && chunkData != 0, "getChunk returns some data");
+
+    std::vector<char> chunkCopy ((const char*) chunkData, (const char*) chunkData + std::max (0, chunkSize));
+
+    for (int i = 0; i < numParams; ++i)
+        plugin.setParameter (i, 0.75f);
+
+    if (chunkSize > 0)
+        plugin.setChunk (&chunkCopy[0], chunkSize, false);
+
+    bool chunkRestored = true;
+    for (int i = 0; i < numParams; ++i)
+        if (fabsf (plugin.getParameter (i) - savedValues[i]) > 0.0001f)
+            chunkRestored = false;
+
+    check (chunkRestored, "setChunk restores the saved parameters");
+
+    void* secondChunk = 0;
+    const int secondSize = plugin.getChunk (&secondChunk, false);
+    check (secondSize == chunkSize
+            && (chunkSize <= 0 || memcmp (secondChunk, &chunkCopy[0], chunkSize) == 0),
+           "getChunk after setChunk is identical");
+
+    // processing
+    TestBuffers in (numIns, blockSize), out1 (numOuts, blockSize), out2 (numOuts, blockSize);
+    in.fillWithSine (0.0, 0.031);
+
+    out1.fill (0.0f);
+    plugin.processReplacing (in.getArray(), out1.getArray(), blockSize);
+    check (out1.isFiniteAndBounded (4.0f), "processReplacing output is finite and bounded");
+
+    out2.fill (0.0f);
+    plugin.processReplacing (in.getArray(), out2.getArray(), blockSize);
+    check (out1.getMaxDifference (out2) < 1.0e-6f, "processReplacing is repeatable for the same input");
+
+    // process() must add its output to what's already in the buffers
+    const float offset = 0.125f;
+    out2.fill (offset);
+    plugin.process (in.getArray(), out2.getArray(), blockSize);
+
+    float accumulateError = 0.0f;
+    for (int i = std::min (numIns, numOuts); --i >= 0;)
+        for (int j = 0; j < blockSize; ++j)
+            accumulateError = std::max (accumulateError,
+                                        fabsf (out2.getChannel (i)[j] - (out1.getChannel (i)[j] + offset)));
+
+    check (accumulateError < 1.0e-5f, "process accumulates onto the output buffers");
+
+    // in-place processing, which some hosts do
+    TestBuffers inPlace (std::max (numIns, numOuts), blockSize);
+    inPlace.fillWithSine (0.0, 0.031);
+    plugin.processReplacing (inPlace.getArray(), inPlace.getArray(), blockSize);
+    check (inPlace.isFiniteAndBounded (4.0f), "in-place processReplacing output is finite");
+
+    plugin.processReplacingTimes.clear();
+    plugin.processTimes.clear();
+    plugin.setParameterTimes.clear();
+    plugin.getChunkTimes.clear();
+    plugin.setChunkTimes.clear();
+}
+
+//==============================================================================
+static void runLoadTest (VstHostedPlugin& plugin, double sampleRate, int blockSize, int numBlocks)
+{
+    const int numIns = plugin.getNumInputs();
+    const int numOuts = plugin.getNumOutputs();
+
+    plugin.reserveTimings (numBlocks);
+
+    TestBuffers in (numIns, blockSize), out (numOuts, blockSize);
+    const double increment = 2.0 * 3.14159265358979 * 441.0 / sampleRate;
+    double phase = 0.0;
+
+    for (int i = 0; i < numBlocks; ++i)
+    {
+        in.fillWithSine (phase, increment);
+        phase += increment * blockSize;
+
+        // an automation move every so often, like a host playing back a lane
+        if ((i & 15) == 0 && plugin.getNumParameters() > 0)
+            plugin.setParameter (i % plugin.getNumParameters(), 0.25f + 0.5f * ((i >> 4) & 1));
+
+        plugin.processReplacing (in.getArray(), out.getArray(), blockSize);
+    }
+
+    for (int i = numBlocks / 4; --i >= 0;)
+    {
+        in.fillWithSine (phase, increment);
+        plugin.process (in.getArray(), out.getArray(), blockSize);
+    }
+
+    for (int i = numBlocks / 16; --i >= 0;)
+    {
+        void* data = 0;
+        const int size = plugin.getChunk (&data, false);
+
+        if (size > 0)
+        {
+            std::vector<char> copy ((const char*) data, (const char*) data + size);
+            plugin.setChunk (&copy[0], size, false);
+        }
+    }
+
+    const double deadline = 1.0e9 * blockSize / sampleRate;
+
+    printf ("\nload test: %d blocks of %d samples at %.0f Hz (deadline %.2f us)\n\n",
+            numBlocks, blockSize, sampleRate, deadline * 0.001);
+
+    printf ("%s\n", VstCallTimings::getDescriptionHeader().c_str());
+    printf ("%s\n", plugin.processReplacingTimes.describe ("processReplacing", deadline).c_str());
+    printf ("%s\n", plugin.processTimes.describe ("process", deadline).c_str());
+    printf ("%s\n", plugin.setParameterTimes.describe ("setParameter", 0).c_str());
+    printf ("%s\n", plugin.getChunkTimes.describe ("getChunk", 0).c_str());
+    printf ("%s\n", plugin.setChunkTimes.describe ("setChunk", 0).c_str());
+    printf ("%s\n", plugin.openTimes.describe ("open", 0).c_str());
+    printf ("%s\n", plugin.resumeTimes.describe ("resume", 0).c_str());
+
+    const double meanLoad = plugin.processReplacingTimes.getMean() / deadline;
+    printf ("\nmean DSP load %.3f%%, realtime factor %.1fx\n",
+            100.0 * meanLoad, meanLoad > 0 ? 1.0 / meanLoad : 0.0);
+}
+
+//==============================================================================
+static const char* getOption (int argc, char* argv[], const char* name, const char* defaultValue)
+{
+    for (int i = 2; i < argc - 1; ++i)
+        if (strcmp (argv[i], name) == 0)
+            return argv [i + 1];
+
+    return defaultValue;
+}
+
+int main (int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        printf ("usage: %s <plugin.so> [--rate 44100] [--block 512] [--blocks 20000]\n", argv[0]);
+        return 2;
+    }
+
+    const double sampleRate = atof (getOption (argc, argv, "--rate", "44100"));
+    const int blockSize = std::max (1, atoi (getOption (argc, argv, "--block", "512")));
+    const int numBlocks = std::max (16, atoi (getOption (argc, argv, "--blocks", "20000")));
+
+    VstPluginModule module;
+    std::string error;
+
+    if (! module.load (argv[1], error))
+    {
+        printf ("couldn't load %s: %s\n", argv[1], error.c_str());
+        return 2;
+    }
+
+    const int64_t startTime = vstHostNanoseconds();
+    VstHostedPlugin plugin (module);
+    const int64_t createTime = vstHostNanoseconds() - startTime;
+
+    if (! plugin.isValid())
+    {
+        printf ("the entry point didn't return a valid AEffect\n");
+        return 2;
+    }
+
+    plugin.open (sampleRate, blockSize);
+    plugin.resume();
+
+    printf ("loaded \"%s\" (id 0x%08x): %d ins, %d outs, %d parameters, instantiated in %.2f ms\n",
+            plugin.getEffectName().c_str(), (unsigned int) plugin.getUniqueId(),
+            plugin.getNumInputs(), plugin.getNumOutputs(), plugin.getNumParameters(),
+            createTime * 1.0e-6);
+
+    runRegressionChecks (plugin, blockSize);
+    runLoadTest (plugin, sampleRate, blockSize, numBlocks);
+
+    plugin.close();
+
+    printf ("\n%d check(s) failed\n", numFailures);
+    return numFailures > 0 ? 1 : 0;
+}
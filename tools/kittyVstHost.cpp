@@ -0,0 +1,374 @@
+#include "kittyVstHost.h"
+
+#include <dlfcn.h>
+#include <time.h>
+#include <string.h>
+#include <stdio.h>
+#include <algorithm>
+
+//==============================================================================
+int64_t vstHostNanoseconds()
+{
+    timespec t;
+    clock_gettime (CLOCK_MONOTONIC, &t);
+    return ((int64_t) t.tv_sec) * 1000000000 + t.tv_nsec;
+}
+
+//==============================================================================
+VstCallTimings::VstCallTimings()
+    : numDropped (0)
+{
+    samples.reserve (16);   // enough for the one-off calls like open and resume
+}
+
+void VstCallTimings::reserve (int numCalls)
+{
+    samples.reserve (samples.size() + numCalls);
+}
+
+void VstCallTimings::clear()
+{
+    samples.clear();   // (keeps the reserved capacity)
+    numDropped = 0;
+}
+
+void VstCallTimings::addFrom (const VstCallTimings& other)
+{
+    samples.insert (samples.end(), other.samples.begin(), other.samples.end());
+    numDropped += other.numDropped;
+}
+
+int64_t VstCallTimings::getMin() const
+{
+    return samples.empty() ? 0 : *std::min_element (samples.begin(), samples.end());
+}
+
+int64_t VstCallTimings::getMax() const
+{
+    return samples.empty() ? 0 : *std::max_element (samples.begin(), samples.end());
+}
+
+double VstCallTimings::getMean() const
+{
+    if (samples.empty())
+        return 0.0;
+
+    double total = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+        total += (double) samples[i];
+
+    return total / samples.size();
+}
+
+int64_t VstCallTimings::getPercentile (double percentile) const
+{
+    if (samples.empty())
+        return 0;
+
+    std::vector<int64_t> sorted (samples);
+    std::sort (sorted.begin(), sorted.end());
+
+    size_t index = (size_t) (percentile * 0.01 * (sorted.size() - 1) + 0.5);
+    return sorted [std::min (index, sorted.size() - 1)];
+}
+
+int VstCallTimings::getNumLongerThan (int64_t nanoseconds) const
+{
+    int num = 0;
+
+    for (size_t i = 0; i < samples.size(); ++i)
+        if (samples[i] > nanoseconds)
+            ++num;
+
+    return num;
+}
+
+std::string VstCallTimings::getDescriptionHeader()
+{
+    return "call                   count     min(us)    mean(us)     p99(us)   p99.9(us)     max(us)   peak load   overruns";
+}
+
+std::string VstCallTimings::describe (const char* name, double deadlineNanoseconds) const
+{
+    char line [256];
+
+    snprintf (line, sizeof (line), "%-18s %9d %11.2f %11.2f %11.2f %11.2f %11.2f",
+              name, getNumCalls(),
+              getMin() * 0.001, getMean() * 0.001,
+              getPercentile (99.0) * 0.001, getPercentile (99.9) * 0.001,
+              getMax() * 0.001);
+
+    std::string s (line);
+
+    if (deadlineNanoseconds > 0)
+    {
+        snprintf (line, sizeof (line), " %10.1f%% %10d",
+                  100.0 * getMax() / deadlineNanoseconds,
+                  getNumLongerThan ((int64_t) deadlineNanoseconds));
+        s += line;
+    }
+
+    return s;
+}
+
+//==============================================================================
+VstPluginModule::VstPluginModule()
+    : handle (0),
+      entryPoint (0)
+{
+}
+
+VstPluginModule::~VstPluginModule()
+{
+    if (handle != 0)
+        dlclose (handle);
+}
+
+bool VstPluginModule::load (const std::string& path, std::string& error)
+{
+    if (handle != 0)
+    {
+        error = "module is already loaded";
+        return false;
+    }
+
+    handle = dlopen (path.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if (handle == 0)
+    {
+        const char* const e = dlerror();
+        error = e != 0 ? e : "dlopen failed";
+        return false;
+    }
+
+    entryPoint = (EntryPoint) dlsym (handle, "VSTPluginMain");
+
+    if (entryPoint == 0)
+        entryPoint = (EntryPoint) dlsym (handle, "main");
+
+    if (entryPoint == 0)
+    {
+        error = "the module doesn't export VSTPluginMain or main";
+        dlclose (handle);
+        handle = 0;
+        return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+// The plugin calls back into the host from inside its entry point, before we've
+// been handed its AEffect, so the instance being created is parked here.
+static __thread VstHostedPlugin* pluginBeingCreated = 0;
+
+VstHostedPlugin::VstHostedPlugin (const VstPluginModule& module)
+    : effect (0),
+      sampleRate (44100.0),
+      blockSize (512),
+      isResumed (false),
+      numHostCallbacks (0)
+{
+    memset (&timeInfo, 0, sizeof (timeInfo));
+
+    if (module.isLoaded())
+    {
+        pluginBeingCreated = this;
+        AEffect* const e = module.getEntryPoint() (&hostCallback);
+        pluginBeingCreated = 0;
+
+        if (e != 0 && e->magic == kEffectMagic)
+        {
+            effect = e;
+            effect->resvd1 = (VstIntPtr) this;
+        }
+    }
+}
+
+VstHostedPlugin::~VstHostedPlugin()
+{
+    close();
+}
+
+VstIntPtr VstHostedPlugin::dispatch (VstInt32 opCode, VstInt32 index, VstIntPtr value, void* ptr, float opt)
+{
+    return effect != 0 ? effect->dispatcher (effect, opCode, index, value, ptr, opt) : 0;
+}
+
+//==============================================================================
+void VstHostedPlugin::open (double newSampleRate, int newBlockSize)
+{
+    sampleRate = newSampleRate;
+    blockSize = newBlockSize;
+
+    timeInfo.sampleRate = sampleRate;
+    timeInfo.tempo = 120.0;
+    timeInfo.timeSigNumerator = 4;
+    timeInfo.timeSigDenominator = 4;
+    timeInfo.flags = kVstTransportPlaying | kVstPpqPosValid | kVstTempoValid | kVstTimeSigValid;
+
+    const int64_t start = vstHostNanoseconds();
+
+    dispatch (effOpen);
+    dispatch (effSetSampleRate, 0, 0, 0, (float) sampleRate);
+    dispatch (effSetBlockSize, 0, blockSize);
+
+    openTimes.add (vstHostNanoseconds() - start);
+}
+
+void VstHostedPlugin::resume()
+{
+    if (! isResumed)
+    {
+        const int64_t start = vstHostNanoseconds();
+
+        dispatch (effMainsChanged, 0, 1);
+        dispatch (effStartProcess);
+
+        resumeTimes.add (vstHostNanoseconds() - start);
+        isResumed = true;
+    }
+}
+
+void VstHostedPlugin::suspend()
+{
+    if (isResumed)
+    {
+        dispatch (effStopProcess);
+        dispatch (effMainsChanged, 0, 0);
+        isResumed = false;
+    }
+}
+
+void VstHostedPlugin::close()
+{
+    if (effect != 0)
+    {
+        suspend();
+
+        // effClose also deletes the plugin object
+        dispatch (effClose);
+        effect = 0;
+    }
+}
+
+const std::string VstHostedPlugin::getEffectName()
+{
+    char name [256];
+    memset (name, 0, sizeof (name));
+    dispatch (effGetEffectName, 0, 0, name);
+    return name;
+}
+
+//==============================================================================
+void VstHostedPlugin::processReplacing (float** inputs, float** outputs, int numSamples)
+{
+    const int64_t start = vstHostNanoseconds();
+    effect->processReplacing (effect, inputs, outputs, numSamples);
+    processReplacingTimes.add (vstHostNanoseconds() - start);
+
+    timeInfo.samplePos += numSamples;
+}
+
+void VstHostedPlugin::process (float** inputs, float** outputs, int numSamples)
+{
+    const int64_t start = vstHostNanoseconds();
+    effect->process (effect, inputs, outputs, numSamples);
+    processTimes.add (vstHostNanoseconds() - start);
+
+    timeInfo.samplePos += numSamples;
+}
+
+void VstHostedPlugin::setParameter (int index, float value)
+{
+    const int64_t start = vstHostNanoseconds();
+    effect->setParameter (effect, index, value);
+    setParameterTimes.add (vstHostNanoseconds() - start);
+}
+
+float VstHostedPlugin::getParameter (int index)
+{
+    return effect->getParameter (effect, index);
+}
+
+int VstHostedPlugin::getChunk (void** data, bool onlyCurrentProgram)
+{
+    *data = 0;
+
+    const int64_t start = vstHostNanoseconds();
+    const int size = (int) dispatch (effGetChunk, onlyCurrentProgram ? 1 : 0, 0, data);
+    getChunkTimes.add (vstHostNanoseconds() - start);
+
+    return size;
+}
+
+void VstHostedPlugin::setChunk (const void* data, int size, bool onlyCurrentProgram)
+{
+    const int64_t start = vstHostNanoseconds();
+    dispatch (effSetChunk, onlyCurrentProgram ? 1 : 0, size, (void*) data);
+    setChunkTimes.add (vstHostNanoseconds() - start);
+}
+
+void VstHostedPlugin::reserveTimings (int numCalls)
+{
+    processReplacingTimes.reserve (numCalls);
+    processTimes.reserve (numCalls);
+    setParameterTimes.reserve (numCalls);
+    getChunkTimes.reserve (numCalls);
+    setChunkTimes.reserve (numCalls);
+}
+
+//==============================================================================
+VstIntPtr VSTCALLBACK VstHostedPlugin::hostCallback (AEffect* effect, VstInt32 opcode, VstInt32 index,
+                                                     VstIntPtr value, void* ptr, float opt)
+{
+    VstHostedPlugin* plugin = pluginBeingCreated;
+
+    if (effect != 0 && effect->resvd1 != 0)
+        plugin = (VstHostedPlugin*) effect->resvd1;
+
+    if (plugin != 0)
+        return plugin->handleHostCallback (opcode, index, value, ptr, opt);
+
+    return opcode == audioMasterVersion ? 2400 : 0;
+}
+
+VstIntPtr VstHostedPlugin::handleHostCallback (VstInt32 opcode, VstInt32, VstIntPtr, void* ptr, float)
+{
+    ++numHostCallbacks;
+
+    switch (opcode)
+    {
+    case audioMasterVersion:
+        return 2400;
+
+    case audioMasterGetTime:
+        timeInfo.ppqPos = timeInfo.samplePos / sampleRate * (timeInfo.tempo / 60.0);
+        return (VstIntPtr) &timeInfo;
+
+    case audioMasterGetSampleRate:
+        return (VstIntPtr) sampleRate;
+
+    case audioMasterGetBlockSize:
+        return blockSize;
+
+    case audioMasterGetCurrentProcessLevel:
+        return kVstProcessLevelRealtime;
+
+    case audioMasterGetVendorString:
+        strcpy ((char*) ptr, "kitty");
+        return 1;
+
+    case audioMasterGetProductString:
+        strcpy ((char*) ptr, "kittyTestHost");
+        return 1;
+
+    case audioMasterCanDo:
+        return (strcmp ((const char*) ptr, "sendVstTimeInfo") == 0) ? 1 : 0;
+
+    default:
+        break;
+    }
+
+    return 0;
+}
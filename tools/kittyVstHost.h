@@ -0,0 +1,186 @@
+/*
+    A minimal in-process VST 2.x host used by the Linux test tools.
+
+    It dlopen()s a built plugin, creates instances through the VSTPluginMain
+    (or legacy "main") export, and wraps the handful of dispatcher calls a
+    host needs to get audio running. Every call that the tools care about is
+    timed into a VstCallTimings object so it can be reported afterwards.
+
+    This deliberately doesn't use JUCE - the plugin carries its own copy, and
+    the host must not share (or fight over) its statics.
+
+    Build with something like:
+
+        g++ -O2 -I<path to vstsdk2.4> tools/kittyVstHost.cpp tools/kittyTestHost.cpp
+            -ldl -lpthread -o kittyTestHost
+*/
+
+#ifndef KITTY_VSTHOST_H
+#define KITTY_VSTHOST_H
+
+#ifndef VST_FORCE_DEPRECATED
+ #define VST_FORCE_DEPRECATED 0     // we want AEffect::process, which 2.4 marks as deprecated
+#endif
+
+#include "pluginterfaces/vst2.x/aeffectx.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//==============================================================================
+/** Returns a monotonic timestamp in nanoseconds. */
+int64_t vstHostNanoseconds();
+
+//==============================================================================
+/**
+    Collects the durations of a series of calls, and can summarise them.
+
+    Storage is reserved up-front so that adding a sample during a timed run
+    never allocates.
+*/
+class VstCallTimings
+{
+public:
+    VstCallTimings();
+
+    void reserve (int numCalls);
+    void clear();
+
+    /** Adds all the durations from another list to this one. */
+    void addFrom (const VstCallTimings& other);
+
+    void add (int64_t nanoseconds)
+    {
+        if (samples.size() < samples.capacity())
+            samples.push_back (nanoseconds);
+        else
+            ++numDropped;
+    }
+
+    int getNumCalls() const                 { return (int) samples.size(); }
+    int getNumDropped() const               { return numDropped; }
+
+    int64_t getMin() const;
+    int64_t getMax() const;
+    double getMean() const;
+
+    /** Returns the given percentile (0 to 100) of the recorded durations. */
+    int64_t getPercentile (double percentile) const;
+
+    /** Counts how many calls took longer than the given time. */
+    int getNumLongerThan (int64_t nanoseconds) const;
+
+    /** Appends one line of summary figures to a table.
+        If deadlineNanoseconds is > 0, the figures are also shown relative to it.
+    */
+    std::string describe (const char* name, double deadlineNanoseconds) const;
+
+    /** Returns the header line matching describe(). */
+    static std::string getDescriptionHeader();
+
+private:
+    std::vector<int64_t> samples;
+    int numDropped;
+};
+
+//==============================================================================
+/**
+    A loaded plugin binary.
+
+    Keep this alive for as long as any VstHostedPlugin made from it exists.
+*/
+class VstPluginModule
+{
+public:
+    VstPluginModule();
+    ~VstPluginModule();
+
+    /** Loads the shared object. Returns false and fills in the error on failure. */
+    bool load (const std::string& path, std::string& error);
+
+    bool isLoaded() const throw()           { return entryPoint != 0; }
+
+    typedef AEffect* (*EntryPoint) (audioMasterCallback);
+    EntryPoint getEntryPoint() const throw()  { return entryPoint; }
+
+private:
+    void* handle;
+    EntryPoint entryPoint;
+
+    VstPluginModule (const VstPluginModule&);
+    const VstPluginModule& operator= (const VstPluginModule&);
+};
+
+//==============================================================================
+/**
+    One instance of a plugin, with the host side of its callback.
+
+    The call sequence mirrors what a typical host does: open() sends effOpen,
+    the sample rate and block size, then resume() switches the mains on.
+*/
+class VstHostedPlugin
+{
+public:
+    VstHostedPlugin (const VstPluginModule& module);
+    ~VstHostedPlugin();
+
+    bool isValid() const throw()            { return effect != 0; }
+    AEffect* getEffect() const throw()      { return effect; }
+
+    int getNumInputs() const throw()        { return effect->numInputs; }
+    int getNumOutputs() const throw()       { return effect->numOutputs; }
+    int getNumParameters() const throw()    { return effect->numParams; }
+    int getUniqueId() const throw()         { return effect->uniqueID; }
+    bool canReplace() const throw()         { return (effect->flags & effFlagsCanReplacing) != 0; }
+
+    //==============================================================================
+    void open (double sampleRate, int blockSize);
+    void resume();
+    void suspend();
+    void close();
+
+    const std::string getEffectName();
+
+    //==============================================================================
+    void processReplacing (float** inputs, float** outputs, int numSamples);
+    void process (float** inputs, float** outputs, int numSamples);
+
+    void setParameter (int index, float value);
+    float getParameter (int index);
+
+    /** Fetches the plugin's state. The data belongs to the plugin. */
+    int getChunk (void** data, bool onlyCurrentProgram);
+    void setChunk (const void* data, int size, bool onlyCurrentProgram);
+
+    VstIntPtr dispatch (VstInt32 opCode, VstInt32 index = 0, VstIntPtr value = 0,
+                        void* ptr = 0, float opt = 0.0f);
+
+    //==============================================================================
+    VstCallTimings openTimes, resumeTimes;
+    VstCallTimings processReplacingTimes, processTimes;
+    VstCallTimings setParameterTimes, getChunkTimes, setChunkTimes;
+
+    /** Reserves space for this many calls in each of the timing lists. */
+    void reserveTimings (int numCalls);
+
+    /** The number of callbacks the plugin has made to the host. */
+    int getNumHostCallbacks() const throw()     { return numHostCallbacks; }
+
+private:
+    AEffect* effect;
+    double sampleRate;
+    int blockSize;
+    bool isResumed;
+    VstTimeInfo timeInfo;
+    int numHostCallbacks;
+
+    VstIntPtr handleHostCallback (VstInt32 opcode, VstInt32 index, VstIntPtr value, void* ptr, float opt);
+    static VstIntPtr VSTCALLBACK hostCallback (AEffect* effect, VstInt32 opcode, VstInt32 index,
+                                               VstIntPtr value, void* ptr, float opt);
+
+    VstHostedPlugin (const VstHostedPlugin&);
+    const VstHostedPlugin& operator= (const VstHostedPlugin&);
+};
+
+#endif   // KITTY_VSTHOST_H
@@ -0,0 +1,268 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#include "juce_AudioFileInputSource.h"
+
+
+//==============================================================================
+AudioFileInputSource::AudioFileInputSource()
+    : Thread (T("Audio file reader")),
+      active (0),
+      buffer (1, 32),
+      numChannels (0),
+      intData (0),
+      intChannels (0),
+      reader (0),
+      fileSampleRate (0),
+      fileLength (0),
+      readPosition (0),
+      looping (false),
+      finishedReading (0),
+      reachedEnd (0),
+      numUnderruns (0),
+      numSamplesMissed (0)
+{
+}
+
+AudioFileInputSource::~AudioFileInputSource()
+{
+    stop();
+}
+
+//==============================================================================
+const String AudioFileInputSource::start (const File& fileToPlay, const bool shouldLoop)
+{
+    stop();
+
+    file = fileToPlay;
+
+    FileInputStream* const in = file.createInputStream();
+
+    if (in == 0)
+        return T("Couldn't open ") + file.getFullPathName();
+
+    WavAudioFormat wavFormat;
+    reader = wavFormat.createReaderFor (in, true);
+
+    if (reader == 0)
+        return T("Couldn't read ") + file.getFullPathName() + T(" as a WAV file");
+
+    if (reader->numChannels == 0 || reader->lengthInSamples <= 0)
+    {
+        deleteAndZero (reader);
+        return T("There's no audio in ") + file.getFullPathName();
+    }
+
+    numChannels = (int) reader->numChannels;
+    fileSampleRate = reader->sampleRate;
+    fileLength = reader->lengthInSamples;
+    readPosition = 0;
+    looping = shouldLoop;
+
+    const int fifoSize = jmax (readBlockSize * 4, roundDoubleToInt (fileSampleRate * secondsOfBuffering));
+    buffer.setSize (numChannels, fifoSize);
+    buffer.clear();
+    fifo.setTotalSize (fifoSize);
+
+    intData = (int*) juce_calloc (sizeof (int) * numChannels * readBlockSize);
+    intChannels = (int**) juce_calloc (sizeof (int*) * (numChannels + 1));
+
+    for (int i = 0; i < numChannels; ++i)
+        intChannels[i] = intData + i * readBlockSize;
+
+    finishedReading = reachedEnd = numUnderruns = 0;
+    numSamplesMissed = 0;
+
+    // fill the fifo before the audio thread sees it, so it doesn't start off with an underrun
+    while (finishedReading == 0 && fifo.getFreeSpace() >= readBlockSize)
+        readNextBlock();
+
+    startThread (4);
+
+    {
+        const ProcessingGate::ScopedClose gateClosed (gate);
+        active = 1;
+    }
+
+    return String::empty;
+}
+
+void AudioFileInputSource::stop()
+{
+    if (reader == 0)
+        return;
+
+    {
+        // once this returns, the audio thread is done with the fifo
+        const ProcessingGate::ScopedClose gateClosed (gate);
+        active = 0;
+    }
+
+    stopThread (5000);
+
+    deleteAndZero (reader);
+
+    juce_free (intData);
+    intData = 0;
+    juce_free (intChannels);
+    intChannels = 0;
+
+    buffer.setSize (1, 32);
+    fifo.setTotalSize (1);
+}
+
+//==============================================================================
+bool AudioFileInputSource::readBlock (float** channels, const int numChannelsOut, const int numSamples) throw()
+{
+    if (! gate.tryToEnter())
+        return false;
+
+    const bool isActive = (active != 0);
+
+    if (isActive)
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (numSamples, start1, size1, start2, size2);
+
+        const int numRead = size1 + size2;
+
+        for (int i = 0; i < numChannelsOut; ++i)
+        {
+            float* const dest = channels[i];
+
+            if (dest == 0)
+                continue;
+
+            const int source = i % numChannels;
+
+            if (size1 > 0)
+                memcpy (dest, buffer.getSampleData (source, start1), sizeof (float) * size1);
+
+            if (size2 > 0)
+                memcpy (dest + size1, buffer.getSampleData (source, start2), sizeof (float) * size2);
+
+            if (numRead < numSamples)
+                zeromem (dest + numRead, sizeof (float) * (numSamples - numRead));
+        }
+
+        fifo.finishedRead (numRead);
+
+        if (numRead < numSamples)
+        {
+            if (finishedReading != 0)
+            {
+                reachedEnd = 1;
+            }
+            else
+            {
+                ++numUnderruns;
+                numSamplesMissed += numSamples - numRead;
+            }
+        }
+    }
+
+    gate.exit();
+    return isActive;
+}
+
+//==============================================================================
+void AudioFileInputSource::run()
+{
+    while (! threadShouldExit())
+    {
+        // read in big chunks, and only once there's room for a whole one
+        if (finishedReading == 0 && fifo.getFreeSpace() >= readBlockSize)
+            readNextBlock();
+        else
+            wait (20);
+    }
+}
+
+void AudioFileInputSource::readNextBlock()
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (readBlockSize, start1, size1, start2, size2);
+
+    int numRead = readIntoBuffer (start1, size1);
+
+    if (numRead == size1 && size2 > 0)
+        numRead += readIntoBuffer (start2, size2);
+
+    // (flagged before the last samples are published, so the audio thread can't mistake
+    //  the end of the file for an underrun)
+    if (numRead < size1 + size2)
+        finishedReading = 1;
+
+    fifo.finishedWrite (numRead);
+}
+
+int AudioFileInputSource::readIntoBuffer (const int bufferStart, const int numSamples)
+{
+    int numDone = 0;
+
+    while (numDone < numSamples)
+    {
+        if (readPosition >= fileLength)
+        {
+            if (! looping)
+                break;
+
+            readPosition = 0;
+        }
+
+        const int num = (int) jmin ((int64) (numSamples - numDone), fileLength - readPosition);
+
+        reader->read (intChannels, readPosition, num);
+
+        for (int i = 0; i < numChannels; ++i)
+        {
+            const int* const src = intChannels[i];
+            float* const dest = buffer.getSampleData (i, bufferStart + numDone);
+
+            if (reader->usesFloatingPointData)
+            {
+                memcpy (dest, src, sizeof (float) * num);
+            }
+            else
+            {
+                const float scale = 1.0f / (float) 0x7fffffff;
+
+                for (int j = 0; j < num; ++j)
+                    dest[j] = src[j] * scale;
+            }
+        }
+
+        readPosition += num;
+        numDone += num;
+    }
+
+    return numDone;
+}
@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#ifndef __JUCE_AUDIOFILEINPUTSOURCE_JUCEHEADER__
+#define __JUCE_AUDIOFILEINPUTSOURCE_JUCEHEADER__
+
+#include <juce.h>
+#include "../../juce_LockFreeFifo.h"
+#include "../../juce_ProcessingGate.h"
+
+
+//==============================================================================
+/**
+    Plays an audio file into an audio callback, in place of the device's inputs.
+
+    A reader thread decodes the file ahead of time into a single-reader/single-
+    writer fifo holding a few seconds of audio, and the audio thread just copies
+    each block out of it. If the reader falls behind, the callback gets silence
+    for the missing part and the underrun is counted - it never waits for the disk.
+
+    The file is played at whatever rate the device is running at, without any
+    resampling, so check getFileSampleRate() if that matters.
+
+    start() and stop() must be called from the same thread (normally the message
+    thread).
+*/
+class AudioFileInputSource  : private Thread
+{
+public:
+    //==============================================================================
+    AudioFileInputSource();
+    ~AudioFileInputSource();
+
+    //==============================================================================
+    /** Opens a file and fills the fifo, ready for the audio thread to start reading.
+
+        Returns an error message if the file can't be read, or an empty string if it worked.
+    */
+    const String start (const File& file, const bool shouldLoop);
+
+    /** Stops playing and closes the file. */
+    void stop();
+
+    /** Returns true if start() has been called without a matching stop(). */
+    bool isPlaying() const throw()                          { return reader != 0; }
+
+    /** Returns true once a file that isn't looping has played right through. */
+    bool hasReachedEnd() const throw()                      { return reachedEnd != 0; }
+
+    /** Returns the file that's being (or was last) played. */
+    const File& getFile() const throw()                     { return file; }
+
+    double getFileSampleRate() const throw()                { return fileSampleRate; }
+    int64 getFileLengthInSamples() const throw()            { return fileLength; }
+
+    /** The number of blocks that were short because the reader hadn't kept up. */
+    int getNumUnderruns() const throw()                     { return numUnderruns; }
+
+    /** The number of samples per channel that were replaced with silence by underruns. */
+    int64 getNumSamplesMissed() const throw()               { return numSamplesMissed; }
+
+    //==============================================================================
+    /** Called by the audio thread to fill a block with the next part of the file.
+
+        If the file has fewer channels than the block, they're repeated, so a mono
+        file feeds every channel. Returns false, without touching the block, if no
+        file is playing. This never blocks, allocates, or does any i/o.
+    */
+    bool readBlock (float** channels, const int numChannelsOut, const int numSamples) throw();
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    enum
+    {
+        readBlockSize = 16384,      // samples per channel in each read from the file
+        secondsOfBuffering = 4
+    };
+
+    ProcessingGate gate;
+    volatile int active;
+
+    LockFreeFifo fifo;
+    AudioSampleBuffer buffer;
+    int numChannels;
+    int* intData;
+    int** intChannels;
+
+    File file;
+    AudioFormatReader* reader;
+    double fileSampleRate;
+    int64 fileLength, readPosition;
+    bool looping;
+
+    volatile int finishedReading, reachedEnd, numUnderruns;
+    volatile int64 numSamplesMissed;
+
+    void run();
+    void readNextBlock();
+    int readIntoBuffer (const int bufferStart, const int numSamples);
+
+    AudioFileInputSource (const AudioFileInputSource&);
+    const AudioFileInputSource& operator= (const AudioFileInputSource&);
+};
+
+
+#endif   // __JUCE_AUDIOFILEINPUTSOURCE_JUCEHEADER__
@@ -30,7 +30,12 @@
 */
 
 #include "juce_AudioFilterStreamer.h"
+#include "juce_AudioProcessorChain.h"
 #include "../../juce_IncludeCharacteristics.h"
+#include "../../juce_StartupTimings.h"
+
+// the streamers that exist, so the editor can find its filter's timings
+static VoidArray activeStreamers;
 
 
 //==============================================================================
@@ -38,16 +43,31 @@ AudioFilterStreamer::AudioFilterStreamer (AudioProcessor& filterToUse)
     : filter (filterToUse),
       isPlaying (false),
       sampleRate (0),
-      emptyBuffer (1, 32)
+      numActiveInChans (0),
+      numActiveOutChans (0),
+      lastTotalNumInputChannels (-1),
+      lastTotalNumOutputChannels (-1),
+      emptyBuffer (1, 32),
+      realtimeSetup (0),
+      bufferSize (0),
+      lastCallbackStart (0),
+      xrunGapTicks (0),
+      numDeviceXRuns (0),
+      metricsExporter (*this)
 {
     filter.setPlayConfigDetails (JucePlugin_MaxNumInputChannels, JucePlugin_MaxNumOutputChannels, 0, 0);
 
     filter.setPlayHead (this);
+
+    activeStreamers.add (this);
 }
 
 AudioFilterStreamer::~AudioFilterStreamer()
 {
+    activeStreamers.removeValue (this);
+
     audioDeviceStopped();
+    metricsExporter.stop();
 }
 
 void AudioFilterStreamer::audioDeviceIOCallback (const float** inputChannelData,
@@ -56,73 +76,186 @@ void AudioFilterStreamer::audioDeviceIOCallback (const float** inputChannelData,
                                                  int totalNumOutputChannels,
                                                  int numSamples)
 {
-    MidiBuffer midiBuffer;
-    midiCollector.removeNextBlockOfMessages (midiBuffer, numSamples);
+    const int64 startTime = ProcessTimingHistogram::getStartTime();
 
-    int i, numActiveInChans = 0, numActiveOutChans = 0;
-    int numOutsWanted = filter.getNumOutputChannels();
-    const int numInsWanted = filter.getNumInputChannels();
+    // the device can't tell us when it's had an xrun, but a callback that turns
+    // up more than a couple of blocks after the last one means it must have
+    if (lastCallbackStart != 0 && startTime - lastCallbackStart > xrunGapTicks)
+        ++numDeviceXRuns;
 
-    for (i = 0; i < totalNumInputChannels; ++i)
-        if (inputChannelData[i] != 0)
-            inChans [numActiveInChans++] = (float*) inputChannelData[i];
+    lastCallbackStart = startTime;
 
-    while (numActiveInChans < numInsWanted)
-        inChans [numActiveInChans++] = emptyBuffer.getSampleData (0, 0);
+    // (after the first callback on a thread, this is just a check)
+    if (realtimeSetup != 0)
+        realtimeSetup->applyToCurrentThread();
 
-    for (i = 0; i < totalNumOutputChannels; ++i)
-        if (outputChannelData[i] != 0)
-            outChans [numActiveOutChans++] = outputChannelData[i];
+    if (totalNumInputChannels != lastTotalNumInputChannels
+         || totalNumOutputChannels != lastTotalNumOutputChannels)
+    {
+        updateChannelMap (inputChannelData, totalNumInputChannels,
+                          outputChannelData, totalNumOutputChannels);
+    }
 
-    i = 0;
-    while (numActiveOutChans < numOutsWanted)
-        outChans [numActiveOutChans++] = emptyBuffer.getSampleData (++i, 0);
+    int i;
+    const int numOutsWanted = filter.getNumOutputChannels();
+    const int numInsWanted = filter.getNumInputChannels();
 
-    AudioSampleBuffer input (inChans, jmin (numInsWanted, numActiveInChans), numSamples);
-    AudioSampleBuffer output (outChans, jmin (numOutsWanted, numActiveOutChans), numSamples);
+    // The device can hand us different buffers each time, but the channels they
+    // belong to don't change, so this is just a pointer copy per channel. (Only
+    // audioDeviceAboutToStart() can change which channels are active - a device
+    // that's reopened with a different set always calls it first.)
+    for (i = 0; i < numActiveInChans; ++i)
+    {
+        inChans[i] = (float*) inputChannelData [inChanIndexes[i]];
+        jassert (inChans[i] != 0);
+    }
 
+    for (i = 0; i < numActiveOutChans; ++i)
     {
-        const ScopedLock sl (filter.getCallbackLock());
+        outChans[i] = outputChannelData [outChanIndexes[i]];
+        jassert (outChans[i] != 0);
+    }
+
+    const int numOuts = jmax (numOutsWanted, numActiveOutChans);
 
+    for (i = numActiveOutChans; i < numOuts; ++i)
+        outChans[i] = emptyBuffer.getSampleData (i - numActiveOutChans + 1, 0);
+
+    incomingMidi.clear();
+
+#if JucePlugin_WantsMidiInput
+    midiCollector.removeNextBlockOfMessages (incomingMidi, numSamples);
+#endif
+
+    if (! processingGate.tryToEnter())
+    {
+        for (i = 0; i < numOuts; ++i)
+            zeromem (outChans[i], sizeof (float) * numSamples);
+    }
+    else
+    {
         if (filter.isSuspended())
         {
-            output.clear();
+            for (i = 0; i < numOutsWanted; ++i)
+                zeromem (outChans[i], sizeof (float) * numSamples);
         }
         else
         {
-            for (int i = jmin (output.getNumChannels(), input.getNumChannels()); --i >= 0;)
-                output.copyFrom (i, 0, input, i, 0, numSamples);
-
-            filter.processBlock (output, midiBuffer);
+            const int numInsToFill = jmin (numOutsWanted, numInsWanted);
+
+            // a file that's playing replaces the device's inputs altogether
+            if (! fileInput.readBlock (outChans, numInsToFill, numSamples))
+            {
+                // inputs that the device doesn't have are silent
+                for (i = numInsToFill; --i >= 0;)
+                {
+                    if (i < numActiveInChans)
+                    {
+                        if (outChans[i] != inChans[i])
+                            memcpy (outChans[i], inChans[i], sizeof (float) * numSamples);
+                    }
+                    else
+                    {
+                        zeromem (outChans[i], sizeof (float) * numSamples);
+                    }
+                }
+            }
+
+            AudioSampleBuffer output (outChans, numOutsWanted, numSamples);
+            filter.processBlock (output, incomingMidi);
         }
+
+        processingGate.exit();
     }
 
-    while (numOutsWanted < numActiveOutChans)
-        zeromem (outChans[numOutsWanted++], sizeof (float) * numSamples);
+    for (i = numOutsWanted; i < numActiveOutChans; ++i)
+        zeromem (outChans[i], sizeof (float) * numSamples);
+
+    // (this only copies into the recorder's fifo - its own thread does the writing)
+    recorder.addBlock ((const float**) outChans, numOutsWanted, numSamples);
+
+    timings.addCallback (startTime, numSamples);
+}
+
+void AudioFilterStreamer::updateChannelMap (const float** inputChannelData, int totalNumInputChannels,
+                                            float** outputChannelData, int totalNumOutputChannels)
+{
+    int i;
+    numActiveInChans = numActiveOutChans = 0;
+
+    for (i = 0; i < totalNumInputChannels && numActiveInChans < numElementsInArray (inChanIndexes); ++i)
+        if (inputChannelData[i] != 0)
+            inChanIndexes [numActiveInChans++] = i;
+
+    for (i = 0; i < totalNumOutputChannels && numActiveOutChans < numElementsInArray (outChanIndexes); ++i)
+        if (outputChannelData[i] != 0)
+            outChanIndexes [numActiveOutChans++] = i;
+
+    lastTotalNumInputChannels = totalNumInputChannels;
+    lastTotalNumOutputChannels = totalNumOutputChannels;
 }
 
 void AudioFilterStreamer::audioDeviceAboutToStart (AudioIODevice* device)
 {
+    const ProcessingGate::ScopedClose gateClosed (processingGate);
+
     sampleRate = device->getCurrentSampleRate();
 
     isPlaying = true;
 
+    bufferSize = device->getCurrentBufferSizeSamples();
+
+    timings.setPlayConfig (sampleRate, bufferSize);
+    lastCallbackStart = 0;
+    xrunGapTicks = (int64) (Time::getHighResolutionTicksPerSecond() * 2.0 * bufferSize / sampleRate);
+
     emptyBuffer.setSize (1 + filter.getNumOutputChannels(),
-                         jmax (2048, device->getCurrentBufferSizeSamples() * 2));
+                         jmax (2048, bufferSize * 2));
     emptyBuffer.clear();
 
+    // work out the channel map now rather than in the callback. The device only
+    // passes buffers for its active channels, so that's all that we'll look at.
+    const BitArray activeIns (device->getActiveInputChannels());
+    const BitArray activeOuts (device->getActiveOutputChannels());
+
+    numActiveInChans = numActiveOutChans = 0;
+
+    for (int i = 0; i <= activeIns.getHighestBit() && numActiveInChans < numElementsInArray (inChanIndexes); ++i)
+        if (activeIns[i])
+            inChanIndexes [numActiveInChans++] = i;
+
+    for (int i = 0; i <= activeOuts.getHighestBit() && numActiveOutChans < numElementsInArray (outChanIndexes); ++i)
+        if (activeOuts[i])
+            outChanIndexes [numActiveOutChans++] = i;
+
+    lastTotalNumInputChannels = activeIns.getHighestBit() + 1;
+    lastTotalNumOutputChannels = activeOuts.getHighestBit() + 1;
+
+#if JucePlugin_WantsMidiInput
+    // enough room for a busy block of midi, so the callback doesn't need to allocate
+    incomingMidi.ensureSize (jmax (2048, bufferSize * 8));
+#endif
+
     midiCollector.reset (sampleRate);
 
-    filter.prepareToPlay (device->getCurrentSampleRate(),
-                          device->getCurrentBufferSizeSamples());
+    filter.prepareToPlay (device->getCurrentSampleRate(), bufferSize);
+
+    // lock the memory once the filter has allocated everything it needs
+    if (realtimeSetup != 0)
+        realtimeSetup->lockMemory();
 }
 
 void AudioFilterStreamer::audioDeviceStopped()
 {
+    recorder.stop();
+
+    const ProcessingGate::ScopedClose gateClosed (processingGate);
+
     isPlaying = false;
     filter.releaseResources();
     midiCollector.reset (sampleRate > 0 ? sampleRate : 44100.0);
     emptyBuffer.setSize (1, 32);
+    lastTotalNumInputChannels = lastTotalNumOutputChannels = -1;
 }
 
 void AudioFilterStreamer::handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message)
@@ -137,10 +270,62 @@ bool AudioFilterStreamer::getCurrentPosition (AudioPlayHead::CurrentPositionInfo
     return false;
 }
 
+const String AudioFilterStreamer::startRecording (const File& file, const double sampleRateIfNotRunning)
+{
+    const double rate = isPlaying ? sampleRate : sampleRateIfNotRunning;
+
+    if (rate <= 0)
+        return T("The audio device isn't running");
+
+    return recorder.start (file, rate, filter.getNumOutputChannels());
+}
+
+void AudioFilterStreamer::stopRecording()
+{
+    recorder.stop();
+}
+
+const String AudioFilterStreamer::startFileInput (const File& file, const bool shouldLoop)
+{
+    return fileInput.start (file, shouldLoop);
+}
+
+void AudioFilterStreamer::stopFileInput()
+{
+    fileInput.stop();
+}
+
+void AudioFilterStreamer::startMetricsExport (const File& file, const double intervalSeconds)
+{
+    metricsExporter.start (file, intervalSeconds);
+}
+
+void AudioFilterStreamer::stopMetricsExport()
+{
+    metricsExporter.stop();
+}
+
+void AudioFilterStreamer::setRealtimeSetup (RealtimeAudioSetup* newSetup)
+{
+    // (the callback only reads the pointer, so this is safe while it's running)
+    realtimeSetup = newSetup;
+
+    // a pipelined chain's workers need the same priority as the callback, or they'll stall it
+    AudioProcessorChain* const chain = dynamic_cast <AudioProcessorChain*> (&filter);
+
+    if (chain != 0)
+        chain->setRealtimeSetup (newSetup);
+
+    if (realtimeSetup != 0 && isPlaying)
+        realtimeSetup->lockMemory();
+}
+
 
 //==============================================================================
 AudioFilterStreamingDeviceManager::AudioFilterStreamingDeviceManager()
-    : streamer (0)
+    : streamer (0),
+      realtimeSetup (0),
+      metricsInterval (10.0)
 {
 }
 
@@ -154,7 +339,9 @@ void AudioFilterStreamingDeviceManager::setFilter (AudioProcessor* filterToStrea
 {
     if (streamer != 0)
     {
+#if JucePlugin_WantsMidiInput
         removeMidiInputCallback (String::empty, streamer);
+#endif
         setAudioCallback (0);
 
         delete streamer;
@@ -164,10 +351,58 @@ void AudioFilterStreamingDeviceManager::setFilter (AudioProcessor* filterToStrea
     if (filterToStream != 0)
     {
         streamer = new AudioFilterStreamer (*filterToStream);
+        streamer->setRealtimeSetup (realtimeSetup);
+
+        if (metricsFile != File::nonexistent)
+            streamer->startMetricsExport (metricsFile, metricsInterval);
 
         setAudioCallback (streamer);
+
+#if JucePlugin_WantsMidiInput
         addMidiInputCallback (String::empty, streamer);
+#endif
+    }
+}
+
+void AudioFilterStreamingDeviceManager::setRealtimeSetup (RealtimeAudioSetup* newSetup)
+{
+    realtimeSetup = newSetup;
+
+    if (streamer != 0)
+        streamer->setRealtimeSetup (newSetup);
+}
+
+void AudioFilterStreamingDeviceManager::setMetricsFile (const File& file, const double intervalSeconds)
+{
+    metricsFile = file;
+    metricsInterval = intervalSeconds;
+
+    if (streamer != 0)
+    {
+        if (file != File::nonexistent)
+            streamer->startMetricsExport (file, intervalSeconds);
+        else
+            streamer->stopMetricsExport();
     }
 }
 
 juce_ImplementSingleton (AudioFilterStreamingDeviceManager);
+
+//==============================================================================
+ProcessTimingHistogram* JUCE_CALLTYPE getProcessTimingHistogramFor (const AudioProcessor* processor)
+{
+    for (int i = activeStreamers.size(); --i >= 0;)
+    {
+        AudioFilterStreamer* const s = (AudioFilterStreamer*) activeStreamers.getUnchecked (i);
+
+        if (s->getFilter() == processor)
+            return &(s->getCallbackTimings());
+    }
+
+    return 0;
+}
+
+const PluginStartupTimings* JUCE_CALLTYPE getStartupTimingsFor (const AudioProcessor*)
+{
+    return 0;
+}
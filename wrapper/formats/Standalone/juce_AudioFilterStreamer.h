@@ -33,6 +33,12 @@
 #define __JUCE_AUDIOFILTERSTREAMER_JUCEHEADER__
 
 #include <juce.h>
+#include "../../juce_ProcessingGate.h"
+#include "juce_AudioStreamRecorder.h"
+#include "juce_AudioFileInputSource.h"
+#include "juce_RealtimeAudioSetup.h"
+#include "juce_AudioMetricsExporter.h"
+#include "../../juce_ProcessTimingHistogram.h"
 
 
 //==============================================================================
@@ -73,6 +79,74 @@ public:
 
     bool getCurrentPosition (AudioPlayHead::CurrentPositionInfo& info);
 
+    //==============================================================================
+    /** Starts recording the filter's output to a WAV file.
+
+        This normally records at the rate the device is running at. To arm it before
+        the device has started, pass in the rate that it's going to be started at.
+
+        Recording stops when the device does, or when stopRecording() is called.
+        Returns an error message if it couldn't start.
+    */
+    const String startRecording (const File& file, const double sampleRateIfNotRunning = 0);
+
+    /** Stops recording and closes the file. */
+    void stopRecording();
+
+    /** Returns the recorder, e.g. to check whether it's running or dropping samples. */
+    const AudioStreamRecorder& getRecorder() const throw()      { return recorder; }
+
+    //==============================================================================
+    /** Starts feeding the filter from a WAV file instead of the device's inputs.
+
+        The file is read ahead on a background thread. Returns an error message if
+        it couldn't be opened.
+    */
+    const String startFileInput (const File& file, const bool shouldLoop);
+
+    /** Goes back to using the device's inputs. */
+    void stopFileInput();
+
+    /** Returns the file input, e.g. to check whether it's had any underruns. */
+    const AudioFileInputSource& getFileInput() const throw()    { return fileInput; }
+
+    //==============================================================================
+    /** Gives the streamer a RealtimeAudioSetup to apply to the audio thread and its memory.
+
+        The streamer doesn't delete it, so it must outlive the streamer, or be removed
+        by passing 0 here first.
+    */
+    void setRealtimeSetup (RealtimeAudioSetup* newSetup);
+
+    //==============================================================================
+    /** Returns the timings of the callbacks, measured against each block's duration. */
+    const ProcessTimingHistogram& getCallbackTimings() const throw()    { return timings; }
+    ProcessTimingHistogram& getCallbackTimings() throw()                { return timings; }
+
+    /** Returns the filter that's being streamed. */
+    AudioProcessor* getFilter() const throw()               { return &filter; }
+
+    /** Returns the number of device xruns that have been spotted.
+
+        Devices don't say when they've under- or overrun, so this counts the
+        times that the gap between two callbacks was more than two blocks long.
+    */
+    int getNumDeviceXRuns() const throw()                   { return numDeviceXRuns; }
+
+    /** Returns the rate the device is running at, or 0 if it's stopped. */
+    double getSampleRate() const throw()                    { return isPlaying ? sampleRate : 0.0; }
+    int getBufferSize() const throw()                       { return bufferSize; }
+
+    /** Starts writing the callback counters and timings to a file every so often.
+
+        See AudioMetricsExporter for the format.
+    */
+    void startMetricsExport (const File& file, const double intervalSeconds);
+
+    /** Writes the counters one last time, and stops. */
+    void stopMetricsExport();
+
+    //==============================================================================
     juce_UseDebuggingNewOperator
 
 private:
@@ -81,10 +155,29 @@ private:
     bool isPlaying;
     double sampleRate;
     MidiMessageCollector midiCollector;
+    MidiBuffer incomingMidi;
+    ProcessingGate processingGate;
+
+    // which of the device's channels feed the filter, worked out when it starts
+    int inChanIndexes [128], outChanIndexes [128];
+    int numActiveInChans, numActiveOutChans;
+    int lastTotalNumInputChannels, lastTotalNumOutputChannels;
 
     float* outChans [128];
     float* inChans [128];
     AudioSampleBuffer emptyBuffer;
+    AudioStreamRecorder recorder;
+    AudioFileInputSource fileInput;
+    RealtimeAudioSetup* realtimeSetup;
+
+    ProcessTimingHistogram timings;
+    int bufferSize;
+    int64 lastCallbackStart, xrunGapTicks;
+    volatile int numDeviceXRuns;
+    AudioMetricsExporter metricsExporter;
+
+    void updateChannelMap (const float** inputChannelData, int totalNumInputChannels,
+                           float** outputChannelData, int totalNumOutputChannels);
 };
 
 //==============================================================================
@@ -116,12 +209,30 @@ public:
     */
     void setFilter (AudioProcessor* filterToStream);
 
+    /** Returns the streamer that's running the current filter, or 0 if there isn't one. */
+    AudioFilterStreamer* getStreamer() const throw()            { return streamer; }
+
+    /** Sets a RealtimeAudioSetup for this and any later streamers to use.
+
+        The manager doesn't delete it, so it must stay around until the filter's
+        been removed.
+    */
+    void setRealtimeSetup (RealtimeAudioSetup* newSetup);
+
+    /** Makes this and any later streamers export their counters to a file.
+
+        Pass File::nonexistent to stop.
+    */
+    void setMetricsFile (const File& file, const double intervalSeconds);
 
     //==============================================================================
     juce_UseDebuggingNewOperator
 
 private:
     AudioFilterStreamer* streamer;
+    RealtimeAudioSetup* realtimeSetup;
+    File metricsFile;
+    double metricsInterval;
 };
 
 
@@ -0,0 +1,199 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#include "juce_AudioMetricsExporter.h"
+#include "juce_AudioFilterStreamer.h"
+#include "../../juce_IncludeCharacteristics.h"
+#include "../../juce_ProcessTimingHistogram.h"
+
+#if JUCE_WIN32
+ #include <windows.h>
+#else
+ #include <stdio.h>
+#endif
+
+
+//==============================================================================
+AudioMetricsExporter::AudioMetricsExporter (const AudioFilterStreamer& streamerToWatch)
+    : Thread (T("Audio metrics exporter")),
+      streamer (streamerToWatch),
+      intervalMs (10000)
+{
+}
+
+AudioMetricsExporter::~AudioMetricsExporter()
+{
+    stop();
+}
+
+//==============================================================================
+void AudioMetricsExporter::start (const File& fileToWrite, const double intervalSeconds)
+{
+    stop();
+
+    file = fileToWrite;
+    intervalMs = jmax (100, roundDoubleToInt (intervalSeconds * 1000.0));
+
+    writeSnapshot();
+    startThread (2);
+}
+
+void AudioMetricsExporter::stop()
+{
+    if (isThreadRunning())
+    {
+        stopThread (5000);
+        writeSnapshot();
+    }
+}
+
+void AudioMetricsExporter::run()
+{
+    while (! threadShouldExit())
+    {
+        wait (intervalMs);
+
+        if (! threadShouldExit())
+            writeSnapshot();
+    }
+}
+
+//==============================================================================
+/** Moves source over dest in one step, so that dest is never missing. (File::moveFileTo()
+    deletes the target first, which would leave a gap for a scraper to fall into.)
+*/
+static bool replaceFileAtomically (const File& source, const File& dest)
+{
+#if JUCE_WIN32
+    const String sourcePath (source.getFullPathName());
+    const String destPath (dest.getFullPathName());
+
+    return MoveFileEx (sourcePath, destPath, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return rename (source.getFullPathName().toUTF8(), dest.getFullPathName().toUTF8()) == 0;
+#endif
+}
+
+bool AudioMetricsExporter::writeSnapshot()
+{
+    const ScopedLock sl (writeLock);
+
+    if (file == File::nonexistent)
+        return false;
+
+    // write it alongside and then move it into place, so it's never seen half-written
+    const File temp (file.getSiblingFile (file.getFileName() + T(".tmp")));
+
+    return temp.replaceWithText (createSnapshotText())
+            && replaceFileAtomically (temp, file);
+}
+
+//==============================================================================
+static const String formatValue (const double value)
+{
+    // counters are printed as integers, and everything else as compactly as it'll go
+    if (value == floor (value) && fabs (value) < 1.0e15)
+        return String ((int64) value);
+
+    return String::formatted (T("%.9g"), value);
+}
+
+static void addMetric (String& text, const tchar* const name, const tchar* const type,
+                       const tchar* const help, const String& labels, const double value)
+{
+    text << T("# HELP ") << name << T(" ") << help << T("\n")
+         << T("# TYPE ") << name << T(" ") << type << T("\n")
+         << name << T("{") << labels << T("} ") << formatValue (value) << T("\n");
+}
+
+const String AudioMetricsExporter::createSnapshotText() const
+{
+    ProcessTimingHistogram::Summary s;
+    streamer.getCallbackTimings().getSummary (s);
+
+    const String labels (T("plugin=\"") + String (JucePlugin_Name) + T("\""));
+    String text;
+
+    addMetric (text, T("audio_callbacks_total"), T("counter"),
+               T("Audio callbacks that have run the filter."), labels, s.numCallbacks);
+
+    addMetric (text, T("audio_callback_overruns_total"), T("counter"),
+               T("Callbacks that took longer than the duration of their block."), labels, s.numOverruns);
+
+    addMetric (text, T("audio_callback_near_misses_total"), T("counter"),
+               T("Callbacks that finished within 20% of their block's duration."), labels, s.numNearMisses);
+
+    addMetric (text, T("audio_device_xruns_total"), T("counter"),
+               T("Gaps of more than two blocks between callbacks, where the device must have under- or overrun."),
+               labels, streamer.getNumDeviceXRuns());
+
+    text << T("# HELP audio_callback_duration_seconds How long the callbacks took.\n")
+            T("# TYPE audio_callback_duration_seconds summary\n");
+
+    const double quantiles[] = { 0.5, 0.99, 0.999 };
+    const double quantileMicros[] = { s.p50Micros, s.p99Micros, s.p999Micros };
+
+    for (int i = 0; i < numElementsInArray (quantiles); ++i)
+        text << T("audio_callback_duration_seconds{") << labels
+             << T(",quantile=\"") << formatValue (quantiles[i]) << T("\"} ")
+             << formatValue (quantileMicros[i] * 1.0e-6) << T("\n");
+
+    text << T("audio_callback_duration_seconds_sum{") << labels << T("} ")
+         << formatValue (s.meanMicros * s.numCallbacks * 1.0e-6) << T("\n")
+         << T("audio_callback_duration_seconds_count{") << labels << T("} ")
+         << String (s.numCallbacks) << T("\n");
+
+    addMetric (text, T("audio_callback_max_duration_seconds"), T("gauge"),
+               T("The longest callback."), labels, s.maxMicros * 1.0e-6);
+
+    addMetric (text, T("audio_callback_peak_load_ratio"), T("gauge"),
+               T("The longest callback as a proportion of its block's duration."), labels, s.peakLoad);
+
+    addMetric (text, T("audio_callback_deadline_seconds"), T("gauge"),
+               T("The duration of a block at the current buffer size."), labels, s.nominalDeadlineMicros * 1.0e-6);
+
+    addMetric (text, T("audio_sample_rate_hertz"), T("gauge"),
+               T("The rate that the device is running at, or 0 if it's stopped."), labels, streamer.getSampleRate());
+
+    addMetric (text, T("audio_buffer_size_samples"), T("gauge"),
+               T("The device's buffer size."), labels, streamer.getBufferSize());
+
+    addMetric (text, T("audio_recorder_dropped_samples_total"), T("counter"),
+               T("Samples that the recorder lost because the disk couldn't keep up."),
+               labels, (double) streamer.getRecorder().getNumSamplesDropped());
+
+    addMetric (text, T("audio_input_file_underruns_total"), T("counter"),
+               T("Blocks that were short because the input file's reader couldn't keep up."),
+               labels, streamer.getFileInput().getNumUnderruns());
+
+    return text;
+}
@@ -0,0 +1,96 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#ifndef __JUCE_AUDIOMETRICSEXPORTER_JUCEHEADER__
+#define __JUCE_AUDIOMETRICSEXPORTER_JUCEHEADER__
+
+#include <juce.h>
+
+class AudioFilterStreamer;
+
+
+//==============================================================================
+/**
+    Periodically writes an AudioFilterStreamer's callback counters and timing
+    percentiles to a text file, in the Prometheus text format.
+
+    Each snapshot is written to a temporary file next to the target and then
+    renamed over it, so a scraper (e.g. node_exporter's textfile collector)
+    never sees half a file. The writing happens on its own thread, and only
+    reads counters that the audio thread keeps anyway.
+
+    The counters are cumulative since the streamer was created (or since its
+    timings were last reset), as Prometheus expects.
+*/
+class AudioMetricsExporter  : private Thread
+{
+public:
+    //==============================================================================
+    AudioMetricsExporter (const AudioFilterStreamer& streamerToWatch);
+    ~AudioMetricsExporter();
+
+    //==============================================================================
+    /** Starts writing snapshots to a file every few seconds, replacing what's there. */
+    void start (const File& file, const double intervalSeconds);
+
+    /** Writes a final snapshot and stops. */
+    void stop();
+
+    bool isExporting() const throw()                        { return isThreadRunning(); }
+
+    /** Returns the file that's being (or was last) written to. */
+    const File& getFile() const throw()                     { return file; }
+
+    //==============================================================================
+    /** Writes a snapshot straight away. Returns false if the file couldn't be written. */
+    bool writeSnapshot();
+
+    /** Returns the text of a snapshot. */
+    const String createSnapshotText() const;
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    const AudioFilterStreamer& streamer;
+    File file;
+    int intervalMs;
+    CriticalSection writeLock;
+
+    void run();
+
+    AudioMetricsExporter (const AudioMetricsExporter&);
+    const AudioMetricsExporter& operator= (const AudioMetricsExporter&);
+};
+
+
+#endif   // __JUCE_AUDIOMETRICSEXPORTER_JUCEHEADER__
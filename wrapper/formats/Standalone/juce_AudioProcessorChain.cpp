@@ -0,0 +1,527 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#include "juce_AudioProcessorChain.h"
+#include "../../juce_LockFreeFifo.h"
+
+/** Somewhere in the codebase of your plugin, you need to implement this function
+    and make it create an instance of the filter subclass that you're building.
+*/
+extern AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+
+//==============================================================================
+/** The buffer that one block travels down the pipeline in. */
+class AudioProcessorChain::PipelineSlot
+{
+public:
+    PipelineSlot (const int numChannels, const int maxNumSamples)
+        : buffer (numChannels, maxNumSamples),
+          numSamples (0)
+    {
+        buffer.clear();
+    }
+
+    AudioSampleBuffer buffer;
+    volatile int numSamples;
+};
+
+//==============================================================================
+/** Runs one stage of a pipelined chain on its own thread. */
+class AudioProcessorChain::StageWorker  : public Thread
+{
+public:
+    StageWorker (AudioProcessorChain& owner_, AudioProcessor& stage_,
+                 const int stageIndex, PipelineSlot* const firstSlot)
+        : Thread (T("Chain stage ") + String (stageIndex + 1)),
+          stage (stage_),
+          slot (firstSlot),
+          busy (0),
+          owner (owner_),
+          appliedSetup (0)
+    {
+        // (enough that processBlock shouldn't need to allocate)
+        emptyMidi.ensureSize (256);
+    }
+
+    ~StageWorker()
+    {
+        stopThread (5000);
+    }
+
+    void run()
+    {
+        float* channels [64];
+
+        while (! threadShouldExit())
+        {
+            RealtimeAudioSetup* const setup = owner.realtimeSetup;
+
+            if (setup != appliedSetup)
+            {
+                appliedSetup = setup;
+
+                if (setup != 0)
+                    setup->applyToWorkerThread (owner.workers.size());
+            }
+
+            if (busy == 0)
+            {
+                wait (100);
+                continue;
+            }
+
+            // (so the slot and its samples aren't read before the callback's handed them over)
+            lockFreeMemoryBarrier();
+
+            if (slot->numSamples > 0)
+            {
+                const int numChannels = jmin (slot->buffer.getNumChannels(), numElementsInArray (channels));
+
+                for (int i = 0; i < numChannels; ++i)
+                    channels[i] = slot->buffer.getSampleData (i, 0);
+
+                AudioSampleBuffer block (channels, numChannels, slot->numSamples);
+                emptyMidi.clear();
+
+                stage.processBlock (block, emptyMidi);
+            }
+
+            // (and the processed samples have to be written before it's handed back)
+            lockFreeMemoryBarrier();
+            busy = 0;
+        }
+    }
+
+    AudioProcessor& stage;
+    PipelineSlot* volatile slot;
+    volatile int busy;
+
+private:
+    AudioProcessorChain& owner;
+    RealtimeAudioSetup* appliedSetup;
+    MidiBuffer emptyMidi;
+
+    StageWorker (const StageWorker&);
+    const StageWorker& operator= (const StageWorker&);
+};
+
+
+//==============================================================================
+AudioProcessorChain::AudioProcessorChain()
+    : pipelined (false),
+      isPlaying (false),
+      currentSampleRate (0),
+      blockSize (0),
+      numStalls (0),
+      realtimeSetup (0)
+{
+}
+
+AudioProcessorChain::~AudioProcessorChain()
+{
+    releaseResources();
+}
+
+//==============================================================================
+AudioProcessor* AudioProcessorChain::createForPlugin (const int numStages, const bool pipelined)
+{
+    if (numStages <= 1 && ! pipelined)
+        return createPluginFilter();
+
+    AudioProcessorChain* const chain = new AudioProcessorChain();
+    chain->setPipelined (pipelined);
+
+    for (int i = 0; i < jmax (1, numStages); ++i)
+        chain->addStage (createPluginFilter());
+
+    return chain;
+}
+
+//==============================================================================
+void AudioProcessorChain::addStage (AudioProcessor* const newStage)
+{
+    jassert (! isPlaying);
+
+    if (newStage != 0)
+        stages.add (newStage);
+}
+
+void AudioProcessorChain::setPipelined (const bool shouldBePipelined)
+{
+    jassert (! isPlaying);
+    pipelined = shouldBePipelined;
+}
+
+const String AudioProcessorChain::getDescription() const
+{
+    String s;
+    s << stages.size() << (stages.size() == 1 ? T(" stage") : T(" stages"));
+
+    if (pipelined)
+        s << T(", pipelined");
+
+    const int latency = getLatencySamples();
+
+    if (latency > 0 && currentSampleRate > 0)
+        s << String::formatted (T(", +%d samples (%.1fms)"), latency, latency * 1000.0 / currentSampleRate);
+
+    return s;
+}
+
+//==============================================================================
+const String AudioProcessorChain::getName() const
+{
+    if (stages.size() == 0)
+        return T("Empty chain");
+
+    return String (stages.size()) + T(" x ") + stages.getUnchecked (0)->getName();
+}
+
+void AudioProcessorChain::prepareToPlay (double sampleRate, int samplesPerBlock)
+{
+    releaseResources();
+
+    currentSampleRate = sampleRate;
+    blockSize = samplesPerBlock;
+    int latency = 0;
+    int i;
+
+    for (i = 0; i < stages.size(); ++i)
+    {
+        AudioProcessor* const stage = stages.getUnchecked (i);
+
+        stage->setPlayConfigDetails (getNumInputChannels(), getNumOutputChannels(),
+                                     sampleRate, samplesPerBlock);
+        stage->prepareToPlay (sampleRate, samplesPerBlock);
+
+        latency += stage->getLatencySamples();
+    }
+
+    if (pipelined && stages.size() > 0)
+    {
+        const int numChannels = jmax (1, jmax (getNumInputChannels(), getNumOutputChannels()));
+
+        for (i = 0; i < stages.size(); ++i)
+        {
+            slots.add (new PipelineSlot (numChannels, samplesPerBlock));
+            workers.add (new StageWorker (*this, *stages.getUnchecked (i), i, slots.getUnchecked (i)));
+        }
+
+        for (i = 0; i < workers.size(); ++i)
+            workers.getUnchecked (i)->startThread (9);
+
+        // each stage holds on to a block for a callback
+        latency += stages.size() * samplesPerBlock;
+    }
+
+    numStalls = 0;
+    setLatencySamples (latency);
+    isPlaying = true;
+}
+
+void AudioProcessorChain::releaseResources()
+{
+    if (! isPlaying)
+        return;
+
+    workers.clear();
+    slots.clear();
+
+    for (int i = 0; i < stages.size(); ++i)
+        stages.getUnchecked (i)->releaseResources();
+
+    isPlaying = false;
+}
+
+void AudioProcessorChain::processBlock (AudioSampleBuffer& buffer, MidiBuffer& midiMessages)
+{
+    if (workers.size() > 0)
+    {
+        processPipelined (buffer);
+    }
+    else
+    {
+        for (int i = 0; i < stages.size(); ++i)
+            stages.getUnchecked (i)->processBlock (buffer, midiMessages);
+    }
+}
+
+void AudioProcessorChain::processPipelined (AudioSampleBuffer& buffer)
+{
+    const int numSamples = buffer.getNumSamples();
+    int i;
+
+    // if a stage is still working on the last block, there's nothing to hand on
+    for (i = workers.size(); --i >= 0;)
+    {
+        if (workers.getUnchecked (i)->busy != 0 || numSamples > blockSize)
+        {
+            ++numStalls;
+            buffer.clear();
+            return;
+        }
+    }
+
+    // they've all finished, so make sure that what they wrote is visible before reading it
+    lockFreeMemoryBarrier();
+
+    // the last stage's block goes out, and the new one takes its place...
+    PipelineSlot* const finished = workers.getLast()->slot;
+    const int numChannels = jmin (buffer.getNumChannels(), finished->buffer.getNumChannels());
+    const int numReady = jmin (numSamples, finished->numSamples);
+
+    for (i = 0; i < numChannels; ++i)
+    {
+        float* const io = buffer.getSampleData (i, 0);
+        float* const slotData = finished->buffer.getSampleData (i, 0);
+
+        for (int j = 0; j < numSamples; ++j)
+        {
+            const float in = io[j];
+            io[j] = (j < numReady) ? slotData[j] : 0.0f;
+            slotData[j] = in;
+        }
+    }
+
+    for (i = numChannels; i < buffer.getNumChannels(); ++i)
+        buffer.clear (i, 0, numSamples);
+
+    finished->numSamples = numSamples;
+
+    // ...at the start of the pipeline, and everything else moves along a stage
+    for (i = workers.size(); --i > 0;)
+        workers.getUnchecked (i)->slot = workers.getUnchecked (i - 1)->slot;
+
+    workers.getUnchecked (0)->slot = finished;
+
+    // the slots and the samples in them must be seen by the workers before they start
+    lockFreeMemoryBarrier();
+
+    for (i = 0; i < workers.size(); ++i)
+    {
+        StageWorker* const w = workers.getUnchecked (i);
+        w->busy = 1;
+        w->notify();
+    }
+}
+
+//==============================================================================
+const String AudioProcessorChain::getInputChannelName (const int channelIndex) const
+{
+    return stages.size() > 0 ? stages.getFirst()->getInputChannelName (channelIndex)
+                             : String (channelIndex + 1);
+}
+
+const String AudioProcessorChain::getOutputChannelName (const int channelIndex) const
+{
+    return stages.size() > 0 ? stages.getLast()->getOutputChannelName (channelIndex)
+                             : String (channelIndex + 1);
+}
+
+bool AudioProcessorChain::isInputChannelStereoPair (int index) const
+{
+    return stages.size() > 0 && stages.getFirst()->isInputChannelStereoPair (index);
+}
+
+bool AudioProcessorChain::isOutputChannelStereoPair (int index) const
+{
+    return stages.size() > 0 && stages.getLast()->isOutputChannelStereoPair (index);
+}
+
+bool AudioProcessorChain::acceptsMidi() const
+{
+    for (int i = 0; i < stages.size(); ++i)
+        if (stages.getUnchecked (i)->acceptsMidi())
+            return true;
+
+    return false;
+}
+
+bool AudioProcessorChain::producesMidi() const
+{
+    return stages.size() > 0 && stages.getLast()->producesMidi();
+}
+
+//==============================================================================
+/** Shows each stage's editor in a tab of its own. */
+class AudioProcessorChainEditor  : public AudioProcessorEditor
+{
+public:
+    AudioProcessorChainEditor (AudioProcessorChain* const chain)
+        : AudioProcessorEditor (chain)
+    {
+        addAndMakeVisible (tabs = new TabbedComponent (TabbedButtonBar::TabsAtTop));
+        tabs->setTabBarDepth (tabBarDepth);
+
+        int w = 160, h = 32;
+
+        for (int i = 0; i < chain->getNumStages(); ++i)
+        {
+            Component* page = chain->getStage (i)->createEditorIfNeeded();
+
+            if (page == 0)
+            {
+                page = new Label (String::empty, TRANS("(no editor)"));
+                page->setSize (w, h);
+            }
+
+            w = jmax (w, page->getWidth());
+            h = jmax (h, page->getHeight());
+
+            tabs->addTab (String (i + 1), Colours::white, page, true);
+        }
+
+        setSize (w, h + tabBarDepth);
+    }
+
+    ~AudioProcessorChainEditor()
+    {
+        deleteAllChildren();
+    }
+
+    void resized()
+    {
+        tabs->setBounds (0, 0, getWidth(), getHeight());
+    }
+
+private:
+    enum { tabBarDepth = 24 };
+
+    TabbedComponent* tabs;
+};
+
+AudioProcessorEditor* AudioProcessorChain::createEditor()
+{
+    return new AudioProcessorChainEditor (this);
+}
+
+//==============================================================================
+AudioProcessor* AudioProcessorChain::findStageForParameter (int& index) const
+{
+    for (int i = 0; i < stages.size(); ++i)
+    {
+        AudioProcessor* const stage = stages.getUnchecked (i);
+        const int num = stage->getNumParameters();
+
+        if (index < num)
+            return stage;
+
+        index -= num;
+    }
+
+    return 0;
+}
+
+int AudioProcessorChain::getNumParameters()
+{
+    int num = 0;
+
+    for (int i = 0; i < stages.size(); ++i)
+        num += stages.getUnchecked (i)->getNumParameters();
+
+    return num;
+}
+
+const String AudioProcessorChain::getParameterName (int index)
+{
+    AudioProcessor* const stage = findStageForParameter (index);
+
+    return stage != 0 ? String (stages.indexOf (stage) + 1) + T(": ") + stage->getParameterName (index)
+                      : String::empty;
+}
+
+float AudioProcessorChain::getParameter (int index)
+{
+    AudioProcessor* const stage = findStageForParameter (index);
+    return stage != 0 ? stage->getParameter (index) : 0.0f;
+}
+
+const String AudioProcessorChain::getParameterText (int index)
+{
+    AudioProcessor* const stage = findStageForParameter (index);
+    return stage != 0 ? stage->getParameterText (index) : String::empty;
+}
+
+void AudioProcessorChain::setParameter (int index, float newValue)
+{
+    AudioProcessor* const stage = findStageForParameter (index);
+
+    if (stage != 0)
+        stage->setParameter (index, newValue);
+}
+
+//==============================================================================
+void AudioProcessorChain::getStateInformation (MemoryBlock& destData)
+{
+    XmlElement xml (T("PROCESSORCHAIN"));
+
+    for (int i = 0; i < stages.size(); ++i)
+    {
+        MemoryBlock stageData;
+        stages.getUnchecked (i)->getStateInformation (stageData);
+
+        XmlElement* const e = new XmlElement (T("STAGE"));
+        e->setAttribute (T("state"), stageData.toBase64Encoding());
+        xml.addChildElement (e);
+    }
+
+    copyXmlToBinary (xml, destData);
+}
+
+void AudioProcessorChain::setStateInformation (const void* data, int sizeInBytes)
+{
+    XmlElement* const xml = getXmlFromBinary (data, sizeInBytes);
+
+    if (xml != 0 && xml->hasTagName (T("PROCESSORCHAIN")))
+    {
+        int i = 0;
+
+        forEachXmlChildElementWithTagName (*xml, e, T("STAGE"))
+        {
+            MemoryBlock stageData;
+
+            if (i < stages.size() && stageData.fromBase64Encoding (e->getStringAttribute (T("state"))))
+                stages.getUnchecked (i)->setStateInformation (stageData.getData(), stageData.getSize());
+
+            ++i;
+        }
+    }
+    else
+    {
+        // probably the state of a single instance, so start every stage from that
+        for (int i = 0; i < stages.size(); ++i)
+            stages.getUnchecked (i)->setStateInformation (data, sizeInBytes);
+    }
+
+    delete xml;
+}
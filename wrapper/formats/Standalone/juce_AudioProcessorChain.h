@@ -0,0 +1,162 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#ifndef __JUCE_AUDIOPROCESSORCHAIN_JUCEHEADER__
+#define __JUCE_AUDIOPROCESSORCHAIN_JUCEHEADER__
+
+#include <juce.h>
+#include "juce_RealtimeAudioSetup.h"
+
+
+//==============================================================================
+/**
+    An AudioProcessor that runs a list of other processors one after another,
+    so that the standalone can host a chain of them (e.g. several differently
+    set up instances of the same plugin) as if it were one.
+
+    Normally the stages all run inside the audio callback. In pipelined mode each
+    stage gets a worker thread of its own instead: every callback hands each
+    worker the block that the stage before it finished last time, so a long
+    chain is spread across the cores rather than having to fit into one thread.
+    That costs one block of latency per stage, which getLatencySamples() includes.
+    If it's given a RealtimeAudioSetup, the workers take the audio thread's priority
+    from it, so that they're not the first threads to be preempted.
+
+    The callback never waits for the workers. If one of them hasn't finished
+    by the next callback, that block comes out silent, the pipeline stays where
+    it is, and the stall is counted. (So it only makes sense with a device that
+    calls back in real time, not one that's running flat out.)
+
+    The chain's parameters are all of the stages' parameters, one stage after
+    another. Its state holds each stage's state, and a state that didn't come
+    from a chain is given to every stage. In pipelined mode the stages aren't
+    passed any midi.
+*/
+class AudioProcessorChain  : public AudioProcessor
+{
+public:
+    //==============================================================================
+    AudioProcessorChain();
+    ~AudioProcessorChain();
+
+    //==============================================================================
+    /** Creates an instance of the plugin, or, if more than one stage or a pipeline is
+        asked for, a chain of that many instances of it.
+    */
+    static AudioProcessor* createForPlugin (const int numStages, const bool pipelined);
+
+    //==============================================================================
+    /** Adds a processor to the end of the chain, which will delete it when it's finished.
+        This can't be done while the chain is playing.
+    */
+    void addStage (AudioProcessor* const newStage);
+
+    int getNumStages() const throw()                        { return stages.size(); }
+    AudioProcessor* getStage (const int index) const throw()    { return stages [index]; }
+
+    /** Switches between running the stages in the callback and on worker threads.
+        This can't be done while the chain is playing.
+    */
+    void setPipelined (const bool shouldBePipelined);
+
+    bool isPipelined() const throw()                        { return pipelined; }
+
+    /** Sets the setup whose priority the pipeline's workers should use, or 0 to leave them
+        alone. The workers pick it up when they next wake, and the caller keeps ownership.
+    */
+    void setRealtimeSetup (RealtimeAudioSetup* const newSetup) throw()     { realtimeSetup = newSetup; }
+
+    /** In pipelined mode, the number of blocks that were silent because a worker
+        hadn't finished in time.
+    */
+    int getNumPipelineStalls() const throw()                { return numStalls; }
+
+    /** Returns a line describing the chain and the latency it adds. */
+    const String getDescription() const;
+
+    //==============================================================================
+    const String getName() const;
+
+    void prepareToPlay (double sampleRate, int samplesPerBlock);
+    void releaseResources();
+    void processBlock (AudioSampleBuffer& buffer, MidiBuffer& midiMessages);
+
+    const String getInputChannelName (const int channelIndex) const;
+    const String getOutputChannelName (const int channelIndex) const;
+    bool isInputChannelStereoPair (int index) const;
+    bool isOutputChannelStereoPair (int index) const;
+
+    bool acceptsMidi() const;
+    bool producesMidi() const;
+
+    AudioProcessorEditor* createEditor();
+
+    int getNumParameters();
+    const String getParameterName (int index);
+    float getParameter (int index);
+    const String getParameterText (int index);
+    void setParameter (int index, float newValue);
+
+    int getNumPrograms()                                        { return 0; }
+    int getCurrentProgram()                                     { return 0; }
+    void setCurrentProgram (int)                                { }
+    const String getProgramName (int)                           { return String::empty; }
+    void changeProgramName (int, const String&)                 { }
+
+    void getStateInformation (MemoryBlock& destData);
+    void setStateInformation (const void* data, int sizeInBytes);
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    class PipelineSlot;
+    class StageWorker;
+
+    OwnedArray <AudioProcessor> stages;
+    OwnedArray <PipelineSlot> slots;
+    OwnedArray <StageWorker> workers;
+    bool pipelined, isPlaying;
+    double currentSampleRate;
+    int blockSize;
+    volatile int numStalls;
+    RealtimeAudioSetup* volatile realtimeSetup;
+
+    AudioProcessor* findStageForParameter (int& index) const;
+    void processPipelined (AudioSampleBuffer& buffer);
+
+    AudioProcessorChain (const AudioProcessorChain&);
+    const AudioProcessorChain& operator= (const AudioProcessorChain&);
+};
+
+
+#endif   // __JUCE_AUDIOPROCESSORCHAIN_JUCEHEADER__
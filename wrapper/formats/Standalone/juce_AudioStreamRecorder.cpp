@@ -0,0 +1,220 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#include "juce_AudioStreamRecorder.h"
+
+
+//==============================================================================
+AudioStreamRecorder::AudioStreamRecorder()
+    : Thread (T("Audio recorder")),
+      active (0),
+      buffer (1, 32),
+      numChannels (0),
+      intData (0),
+      intChannels (0),
+      writer (0),
+      numSamplesWritten (0),
+      numSamplesDropped (0)
+{
+}
+
+AudioStreamRecorder::~AudioStreamRecorder()
+{
+    stop();
+}
+
+//==============================================================================
+const String AudioStreamRecorder::start (const File& fileToRecordTo, const double sampleRate,
+                                         const int numChannelsToRecord, const int bitsPerSample)
+{
+    stop();
+
+    if (sampleRate <= 0 || numChannelsToRecord <= 0)
+        return T("There's no audio running to record");
+
+    file = fileToRecordTo;
+
+    if (! file.deleteFile())
+        return T("Couldn't replace ") + file.getFullPathName();
+
+    // (a big stream buffer, so the writes that reach the disk are big sequential ones too)
+    FileOutputStream* const out = file.createOutputStream (1 << 18);
+
+    if (out == 0)
+        return T("Couldn't open ") + file.getFullPathName();
+
+    WavAudioFormat wavFormat;
+    writer = wavFormat.createWriterFor (out, sampleRate, numChannelsToRecord,
+                                        bitsPerSample, StringPairArray(), 0);
+
+    if (writer == 0)
+    {
+        delete out;
+        return T("Couldn't create a WAV file with those settings");
+    }
+
+    numChannels = numChannelsToRecord;
+
+    const int fifoSize = jmax (writeBlockSize * 4, roundDoubleToInt (sampleRate * secondsOfBuffering));
+    buffer.setSize (numChannels, fifoSize);
+    buffer.clear();
+    fifo.setTotalSize (fifoSize);
+
+    intData = (int*) juce_calloc (sizeof (int) * numChannels * writeBlockSize);
+    intChannels = (const int**) juce_calloc (sizeof (int*) * (numChannels + 1));
+
+    numSamplesWritten = numSamplesDropped = 0;
+
+    startThread (4);
+
+    {
+        // the fifo's all set up before the audio thread can see that it's active
+        const ProcessingGate::ScopedClose gateClosed (gate);
+        active = 1;
+    }
+
+    return String::empty;
+}
+
+void AudioStreamRecorder::stop()
+{
+    if (writer == 0)
+        return;
+
+    {
+        // once this returns, the audio thread is done with the fifo
+        const ProcessingGate::ScopedClose gateClosed (gate);
+        active = 0;
+    }
+
+    // the thread writes out whatever's left before it exits
+    stopThread (30000);
+
+    deleteAndZero (writer);
+
+    juce_free (intData);
+    intData = 0;
+    juce_free (intChannels);
+    intChannels = 0;
+
+    buffer.setSize (1, 32);
+    fifo.setTotalSize (1);
+}
+
+//==============================================================================
+void AudioStreamRecorder::addBlock (const float** channels, const int numChannelsIn, const int numSamples) throw()
+{
+    if (! gate.tryToEnter())
+        return;
+
+    if (active != 0)
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (numSamples, start1, size1, start2, size2);
+
+        for (int i = 0; i < numChannels; ++i)
+        {
+            const float* const src = i < numChannelsIn ? channels[i] : 0;
+
+            if (src != 0)
+            {
+                buffer.copyFrom (i, start1, src, size1);
+
+                if (size2 > 0)
+                    buffer.copyFrom (i, start2, src + size1, size2);
+            }
+            else
+            {
+                buffer.clear (i, start1, size1);
+
+                if (size2 > 0)
+                    buffer.clear (i, start2, size2);
+            }
+        }
+
+        fifo.finishedWrite (size1 + size2);
+        numSamplesDropped += numSamples - (size1 + size2);
+    }
+
+    gate.exit();
+}
+
+//==============================================================================
+void AudioStreamRecorder::run()
+{
+    while (! threadShouldExit())
+    {
+        // only write in big chunks, and let the fifo fill up in between
+        if (fifo.getNumReady() >= writeBlockSize)
+            writeNextBlock();
+        else
+            wait (50);
+    }
+
+    while (writeNextBlock() > 0)
+    {}
+}
+
+int AudioStreamRecorder::writeNextBlock()
+{
+    int start1, size1, start2, size2;
+    fifo.prepareToRead (writeBlockSize, start1, size1, start2, size2);
+
+    if (size1 > 0)
+        writeRegion (start1, size1);
+
+    if (size2 > 0)
+        writeRegion (start2, size2);
+
+    fifo.finishedRead (size1 + size2);
+    numSamplesWritten += size1 + size2;
+
+    return size1 + size2;
+}
+
+void AudioStreamRecorder::writeRegion (const int start, const int numSamples)
+{
+    // the writer wants full-scale 32-bit ints, whatever its bit depth is
+    for (int i = 0; i < numChannels; ++i)
+    {
+        const float* const src = buffer.getSampleData (i, start);
+        int* const dest = intData + i * writeBlockSize;
+
+        for (int j = 0; j < numSamples; ++j)
+            dest[j] = (int) (jlimit (-1.0f, 1.0f, src[j]) * (double) 0x7fffffff);
+
+        intChannels[i] = dest;
+    }
+
+    intChannels [numChannels] = 0;
+
+    writer->write (intChannels, numSamples);
+}
@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#ifndef __JUCE_AUDIOSTREAMRECORDER_JUCEHEADER__
+#define __JUCE_AUDIOSTREAMRECORDER_JUCEHEADER__
+
+#include <juce.h>
+#include "../../juce_LockFreeFifo.h"
+#include "../../juce_ProcessingGate.h"
+
+
+//==============================================================================
+/**
+    Records the audio that an audio callback produces to a WAV file, without the
+    callback ever touching the disk.
+
+    The audio thread calls addBlock(), which just copies the samples into a
+    preallocated single-reader/single-writer fifo holding a few seconds of audio.
+    A writer thread takes them out in large chunks, converts them, and writes
+    them to the file. If the disk can't keep up and the fifo fills, the samples
+    that don't fit are dropped and counted, rather than the callback waiting.
+
+    start() and stop() must be called from the same thread (normally the message
+    thread), and they do the file opening and closing themselves.
+*/
+class AudioStreamRecorder  : private Thread
+{
+public:
+    //==============================================================================
+    AudioStreamRecorder();
+    ~AudioStreamRecorder();
+
+    //==============================================================================
+    /** Starts recording to a file, replacing anything that's already there.
+
+        Returns an error message if the file can't be written, or an empty string
+        if it worked.
+    */
+    const String start (const File& file, const double sampleRate,
+                        const int numChannels, const int bitsPerSample = 24);
+
+    /** Writes out whatever is still waiting, and closes the file. */
+    void stop();
+
+    /** Returns true if start() has been called without a matching stop(). */
+    bool isRecording() const throw()                        { return writer != 0; }
+
+    /** Returns the file that's being (or was last) recorded to. */
+    const File& getFile() const throw()                     { return file; }
+
+    /** The number of samples per channel that have gone into the file. */
+    int64 getNumSamplesWritten() const throw()              { return numSamplesWritten; }
+
+    /** The number of samples per channel that were lost because the fifo was full. */
+    int64 getNumSamplesDropped() const throw()              { return numSamplesDropped; }
+
+    //==============================================================================
+    /** Called by the audio thread with each block that should be recorded.
+
+        Channels beyond the number being recorded are ignored, and missing ones
+        are recorded as silence. This never blocks, allocates, or does any i/o.
+    */
+    void addBlock (const float** channels, const int numChannelsIn, const int numSamples) throw();
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    enum
+    {
+        writeBlockSize = 16384,     // samples per channel in each write to the file
+        secondsOfBuffering = 4
+    };
+
+    ProcessingGate gate;
+    volatile int active;
+
+    LockFreeFifo fifo;
+    AudioSampleBuffer buffer;
+    int numChannels;
+    int* intData;
+    const int** intChannels;
+
+    File file;
+    AudioFormatWriter* writer;
+    volatile int64 numSamplesWritten, numSamplesDropped;
+
+    void run();
+    int writeNextBlock();
+    void writeRegion (const int start, const int numSamples);
+
+    AudioStreamRecorder (const AudioStreamRecorder&);
+    const AudioStreamRecorder& operator= (const AudioStreamRecorder&);
+};
+
+
+#endif   // __JUCE_AUDIOSTREAMRECORDER_JUCEHEADER__
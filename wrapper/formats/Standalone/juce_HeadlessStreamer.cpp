@@ -0,0 +1,601 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#include "juce_HeadlessStreamer.h"
+#include "juce_AudioFilterStreamer.h"
+#include "juce_NullAudioIODevice.h"
+#include "juce_SharedMemoryAudioIODevice.h"
+#include "juce_PipeAudioIODevice.h"
+#include "juce_AudioProcessorChain.h"
+#include "../../juce_IncludeCharacteristics.h"
+
+#include <stdio.h>
+#include <signal.h>
+
+#if JUCE_WIN32
+ #include <io.h>
+ #include <fcntl.h>
+#endif
+
+
+#if JucePlugin_HasReducedRateExport
+ extern const String JUCE_CALLTYPE exportPluginFilterAtReducedRate (AudioProcessor& filter,
+                                                                    const File& source, const File& dest,
+                                                                    const bool packToBitDepth, String& summary);
+#endif
+
+
+//==============================================================================
+static const String getOption (const StringArray& args, const tchar* const name, const String& defaultValue)
+{
+    const int index = args.indexOf (name);
+
+    return (index >= 0 && index < args.size() - 1) ? args [index + 1] : defaultValue;
+}
+
+static bool hasFlag (const StringArray& args, const tchar* const name)
+{
+    return args.contains (name);
+}
+
+// (in pipe mode, stdout's carrying the audio, so everything else goes to stderr)
+static FILE* messageStream = stdout;
+
+static void print (const String& text)
+{
+    fputs ((const char*) text, messageStream);
+    fflush (messageStream);
+}
+
+/** Applies each "--param index=value" to the filter. */
+static bool applyParameters (const StringArray& args, AudioProcessor& filter)
+{
+    for (int i = 0; i < args.size() - 1; ++i)
+    {
+        if (args[i] == T("--param"))
+        {
+            const String setting (args [i + 1]);
+            const int index = setting.upToFirstOccurrenceOf (T("="), false, false).getIntValue();
+
+            if (! setting.containsChar (T('=')) || index < 0 || index >= filter.getNumParameters())
+            {
+                print (T("bad parameter setting: ") + setting + T("\n"));
+                return false;
+            }
+
+            filter.setParameter (index, setting.fromFirstOccurrenceOf (T("="), false, false).getFloatValue());
+        }
+    }
+
+    return true;
+}
+
+/** Prints what a chain added, if the filter is one. */
+static void printChainSummary (AudioProcessor& filter)
+{
+    const AudioProcessorChain* const chain = dynamic_cast <const AudioProcessorChain*> (&filter);
+
+    if (chain != 0)
+        print (T("chain: ") + chain->getDescription()
+                + String::formatted (T(", %d pipeline stalls\n"), chain->getNumPipelineStalls()));
+}
+
+//==============================================================================
+static int runNullDevice (const StringArray& args, AudioProcessor& filter)
+{
+    const double sampleRate = getOption (args, T("--rate"), T("44100")).getDoubleValue();
+    const int bufferSize = getOption (args, T("--buffer"), T("512")).getIntValue();
+    const int numIns = getOption (args, T("--inputs"), String (JucePlugin_MaxNumInputChannels)).getIntValue();
+    const int numOuts = getOption (args, T("--outputs"), String (JucePlugin_MaxNumOutputChannels)).getIntValue();
+    const bool realTime = hasFlag (args, T("--realtime"));
+
+    if (sampleRate <= 0 || bufferSize <= 0)
+    {
+        print (T("the sample rate and buffer size must be positive\n"));
+        return 1;
+    }
+
+    AudioFilterStreamer streamer (filter);
+    const String inputFile (getOption (args, T("--input"), String::empty));
+    const bool loopInput = hasFlag (args, T("--loop"));
+
+    if (inputFile.isNotEmpty())
+    {
+        const String inputError (streamer.startFileInput (File (inputFile), loopInput));
+
+        if (inputError.isNotEmpty())
+        {
+            print (inputError + T("\n"));
+            return 1;
+        }
+
+        if (fabs (streamer.getFileInput().getFileSampleRate() - sampleRate) > 0.5)
+            print (String::formatted (T("warning: the input file's rate is %.0fHz, but it'll be played at %.0fHz\n"),
+                                      streamer.getFileInput().getFileSampleRate(), sampleRate));
+    }
+
+    int64 numBlocks = getOption (args, T("--blocks"), T("0")).getLargeIntValue();
+
+    // a file that isn't looping is played once through, unless a length's been given
+    if (numBlocks <= 0 && inputFile.isNotEmpty() && ! loopInput && ! args.contains (T("--seconds")))
+        numBlocks = (streamer.getFileInput().getFileLengthInSamples() + bufferSize - 1) / bufferSize;
+
+    if (numBlocks <= 0)
+        numBlocks = jmax ((int64) 1, (int64) (getOption (args, T("--seconds"), T("10")).getDoubleValue()
+                                                * sampleRate / bufferSize));
+
+    NullAudioIODevice device (numIns, numOuts);
+    device.setPacing (realTime ? NullAudioIODevice::realTime : NullAudioIODevice::freeRunning);
+    device.setInputTone (getOption (args, T("--tone"), T("440")).getDoubleValue(),
+                         hasFlag (args, T("--silent")) ? 0.0f : 0.5f);
+    device.setMaxNumBlocks (numBlocks);
+
+    BitArray ins, outs;
+    ins.setRange (0, numIns, true);
+    outs.setRange (0, numOuts, true);
+
+    const String error (device.open (ins, outs, sampleRate, bufferSize));
+
+    if (error.isNotEmpty())
+    {
+        print (error + T("\n"));
+        return 1;
+    }
+
+    print (String::formatted (T("null device: %.0fHz, %d samples, %d in, %d out, "),
+                              sampleRate, bufferSize, numIns, numOuts)
+            + (realTime ? T("real-time\n") : T("free-running\n")));
+
+    const String recordFile (getOption (args, T("--record"), String::empty));
+
+    // (armed before the device starts, so that the first block is in the file too)
+    if (recordFile.isNotEmpty())
+    {
+        const String recordError (streamer.startRecording (File (recordFile), sampleRate));
+
+        if (recordError.isNotEmpty())
+        {
+            print (recordError + T("\n"));
+            return 1;
+        }
+    }
+
+    RealtimeAudioSetup* const realtimeSetup = RealtimeAudioSetup::createFromCommandLine (args);
+    streamer.setRealtimeSetup (realtimeSetup);
+
+    const String metricsFile (getOption (args, T("--metrics"), String::empty));
+
+    if (metricsFile.isNotEmpty())
+        streamer.startMetricsExport (File (metricsFile),
+                                     getOption (args, T("--metrics-interval"), T("10")).getDoubleValue());
+
+    device.start (&streamer);
+    device.waitUntilFinished();
+
+    const AudioStreamRecorder& recorder = streamer.getRecorder();
+    const bool wasRecording = recorder.isRecording();
+
+    device.stop();
+    device.close();
+
+    streamer.setRealtimeSetup (0);
+    streamer.stopMetricsExport();
+
+    if (realtimeSetup != 0)
+    {
+        print (realtimeSetup->getReport());
+        delete realtimeSetup;
+    }
+
+    const double audioSeconds = device.getNumBlocksDone() * bufferSize / sampleRate;
+    const double wallSeconds = jmax (1.0e-9, device.getSecondsRunning());
+
+    print (String::formatted (T("blocks: %d, %.2fs of audio in %.2fs, %.1fx real time\n"),
+                              (int) device.getNumBlocksDone(), audioSeconds, wallSeconds,
+                              audioSeconds / wallSeconds));
+
+    print (device.getCallbackTimings().getSummaryText());
+
+    if (realTime)
+        print (String::formatted (T("wake-up lateness: avg %.3fms, max %.3fms, xruns: %d (%d seen by the streamer)\n"),
+                                  device.getMeanLatenessMs(), device.getMaxLatenessMs(),
+                                  device.getNumXRuns(), streamer.getNumDeviceXRuns()));
+
+    printChainSummary (filter);
+
+    if (inputFile.isNotEmpty())
+        print (String::formatted (T("input underruns: %d, %d samples missed\n"),
+                                  streamer.getFileInput().getNumUnderruns(),
+                                  (int) streamer.getFileInput().getNumSamplesMissed()));
+
+    // (stopping the device closed the file, so these are the final figures)
+    if (wasRecording)
+        print (String::formatted (T("recorded %d samples to "), (int) recorder.getNumSamplesWritten())
+                + recorder.getFile().getFullPathName()
+                + String::formatted (T(", %d dropped\n"), (int) recorder.getNumSamplesDropped()));
+
+    if (metricsFile.isNotEmpty())
+        print (T("metrics written to ") + File (metricsFile).getFullPathName() + T("\n"));
+
+    return 0;
+}
+
+//==============================================================================
+static volatile sig_atomic_t interrupted = 0;
+
+static void handleInterrupt (int)
+{
+    interrupted = 1;
+}
+
+static int runSharedMemoryDevice (const StringArray& args, AudioProcessor& filter)
+{
+    String segmentName (getOption (args, T("--shm"), T("/kitty")));
+
+    // (the name's optional)
+    if (segmentName.startsWith (T("--")))
+        segmentName = T("/kitty");
+
+    const double sampleRate = getOption (args, T("--rate"), T("44100")).getDoubleValue();
+    const int bufferSize = getOption (args, T("--buffer"), T("256")).getIntValue();
+    const int numIns = getOption (args, T("--inputs"), String (JucePlugin_MaxNumInputChannels)).getIntValue();
+    const int numOuts = getOption (args, T("--outputs"), String (JucePlugin_MaxNumOutputChannels)).getIntValue();
+    const int numSlots = getOption (args, T("--slots"), T("4")).getIntValue();
+    const double maxSeconds = getOption (args, T("--seconds"), T("0")).getDoubleValue();
+
+    SharedMemoryAudioIODevice device (segmentName, numIns, numOuts, numSlots);
+
+    BitArray ins, outs;
+    ins.setRange (0, numIns, true);
+    outs.setRange (0, numOuts, true);
+
+    const String error (device.open (ins, outs, sampleRate, bufferSize));
+
+    if (error.isNotEmpty())
+    {
+        print (error + T("\n"));
+        return 1;
+    }
+
+    AudioFilterStreamer streamer (filter);
+
+    RealtimeAudioSetup* const realtimeSetup = RealtimeAudioSetup::createFromCommandLine (args);
+    streamer.setRealtimeSetup (realtimeSetup);
+
+    const String metricsFile (getOption (args, T("--metrics"), String::empty));
+
+    if (metricsFile.isNotEmpty())
+        streamer.startMetricsExport (File (metricsFile),
+                                     getOption (args, T("--metrics-interval"), T("10")).getDoubleValue());
+
+    // (so that ctrl-c still closes the device, and the segment doesn't get left behind)
+    interrupted = 0;
+    signal (SIGINT, handleInterrupt);
+    signal (SIGTERM, handleInterrupt);
+
+    device.start (&streamer);
+
+    print (String::formatted (T("serving %d in, %d out at %.0fHz, %d samples per block, on shared memory "),
+                              numIns, numOuts, sampleRate, bufferSize)
+            + segmentName + T(" - waiting for a client\n"));
+
+    const uint32 startTime = Time::getMillisecondCounter();
+
+    while (! (interrupted || device.waitForClientToFinish (100)))
+        if (maxSeconds > 0 && Time::getMillisecondCounter() - startTime >= (uint32) (maxSeconds * 1000.0))
+            break;
+
+    device.stop();
+    device.close();
+
+    signal (SIGINT, SIG_DFL);
+    signal (SIGTERM, SIG_DFL);
+
+    streamer.setRealtimeSetup (0);
+    streamer.stopMetricsExport();
+
+    if (realtimeSetup != 0)
+    {
+        print (realtimeSetup->getReport());
+        delete realtimeSetup;
+    }
+
+    print (String::formatted (T("blocks: %d, %.2fs of audio, %d stalls waiting for the client to read its output\n"),
+                              (int) device.getNumBlocksDone(),
+                              device.getNumBlocksDone() * bufferSize / sampleRate,
+                              device.getNumOutputStalls()));
+
+    print (streamer.getCallbackTimings().getSummaryText());
+
+    printChainSummary (filter);
+
+    if (metricsFile.isNotEmpty())
+        print (T("metrics written to ") + File (metricsFile).getFullPathName() + T("\n"));
+
+    return 0;
+}
+
+//==============================================================================
+static int runPipe (const StringArray& args, AudioProcessor& filter)
+{
+    const double sampleRate = getOption (args, T("--rate"), T("44100")).getDoubleValue();
+    const int bufferSize = getOption (args, T("--buffer"), T("4096")).getIntValue();
+    const int numChannels = getOption (args, T("--channels"), String (JucePlugin_MaxNumOutputChannels)).getIntValue();
+    const String formatName (getOption (args, T("--format"), T("f32")));
+
+    PipeAudioIODevice::SampleFormat format;
+
+    if (! PipeAudioIODevice::parseSampleFormat (formatName, format))
+    {
+        print (T("unknown sample format: ") + formatName + T(" (use f32, s16, s24 or s32)\n"));
+        return 1;
+    }
+
+#if JUCE_WIN32
+    _setmode (_fileno (stdin), _O_BINARY);
+    _setmode (_fileno (stdout), _O_BINARY);
+#else
+    // (a reader that goes away should end the run, not kill the process)
+    signal (SIGPIPE, SIG_IGN);
+#endif
+
+    PipeAudioIODevice device (stdin, stdout, numChannels, format);
+
+    BitArray channels;
+    channels.setRange (0, numChannels, true);
+
+    const String error (device.open (channels, channels, sampleRate, bufferSize));
+
+    if (error.isNotEmpty())
+    {
+        print (error + T("\n"));
+        return 1;
+    }
+
+    AudioFilterStreamer streamer (filter);
+
+    device.start (&streamer);
+    device.waitUntilFinished();
+    device.stop();
+
+    const String ioError (device.getLastError());
+    device.close();
+
+    const double audioSeconds = device.getNumFramesWritten() / sampleRate;
+    const double wallSeconds = jmax (1.0e-9, device.getSecondsRunning());
+
+    print (String::formatted (T("pipe: %d frames of %d channel "), (int) device.getNumFramesWritten(), numChannels)
+            + formatName
+            + String::formatted (T(", %.2fs of audio in %.2fs, %.1fx real time, waiting for i/o %.0f%% of the time\n"),
+                                 audioSeconds, wallSeconds, audioSeconds / wallSeconds,
+                                 100.0 * device.getProportionOfTimeWaitingForIO()));
+
+    print (streamer.getCallbackTimings().getSummaryText());
+
+    printChainSummary (filter);
+
+    // (nothing's trimmed, so the output's this much later than the input)
+    if (filter.getLatencySamples() > 0)
+        print (String::formatted (T("the output is delayed by the filter's latency of %d samples\n"),
+                                  filter.getLatencySamples()));
+
+    if (ioError.isNotEmpty())
+    {
+        print (ioError + T("\n"));
+        return 1;
+    }
+
+    return 0;
+}
+
+//==============================================================================
+static int runExport (const StringArray& args, AudioProcessor& filter)
+{
+    const int index = args.indexOf (T("--export"));
+
+    if (index < 0 || index >= args.size() - 2)
+    {
+        print (T("usage: --export source.wav dest.wav [--pack]\n"));
+        return 1;
+    }
+
+#if JucePlugin_HasReducedRateExport
+    String summary;
+    const String error (exportPluginFilterAtReducedRate (filter, File (args [index + 1]), File (args [index + 2]),
+                                                         hasFlag (args, T("--pack")), summary));
+
+    if (error.isNotEmpty())
+    {
+        print (error + T("\n"));
+        return 1;
+    }
+
+    print (summary + T("\n"));
+    return 0;
+#else
+    (void) filter;
+    print (T("This filter can't be exported at a reduced rate\n"));
+    return 1;
+#endif
+}
+
+//==============================================================================
+/** Returns the comma-separated numbers given for an option, or the defaults if it's not there. */
+static const StringArray getListOption (const StringArray& args, const tchar* const name, const StringArray& defaults)
+{
+    const String list (getOption (args, name, String::empty));
+
+    if (list.isEmpty())
+        return defaults;
+
+    StringArray items;
+    items.addTokens (list, T(","), 0);
+    items.trim();
+    items.removeEmptyStrings();
+    return items;
+}
+
+static int runSweep (const StringArray& args, AudioProcessor& filter)
+{
+    const int numIns = getOption (args, T("--inputs"), String (JucePlugin_MaxNumInputChannels)).getIntValue();
+    const int numOuts = getOption (args, T("--outputs"), String (JucePlugin_MaxNumOutputChannels)).getIntValue();
+    const double secondsPerRun = jmax (0.01, getOption (args, T("--seconds"), T("2")).getDoubleValue());
+    const bool realTime = hasFlag (args, T("--realtime"));
+
+    NullAudioIODevice device (numIns, numOuts);
+    device.setPacing (realTime ? NullAudioIODevice::realTime : NullAudioIODevice::freeRunning);
+    device.setLatencyProbe (true);
+
+    // by default, everything the device supports
+    StringArray defaultRates, defaultSizes;
+    int i;
+
+    for (i = 0; i < device.getNumSampleRates(); ++i)
+        defaultRates.add (String (roundDoubleToInt (device.getSampleRate (i))));
+
+    for (i = 0; i < device.getNumBufferSizesAvailable(); ++i)
+        defaultSizes.add (String (device.getBufferSizeSamples (i)));
+
+    const StringArray rates (getListOption (args, T("--rates"), defaultRates));
+    const StringArray sizes (getListOption (args, T("--buffers"), defaultSizes));
+
+    BitArray ins, outs;
+    ins.setRange (0, numIns, true);
+    outs.setRange (0, numOuts, true);
+
+    AudioFilterStreamer streamer (filter);
+
+    RealtimeAudioSetup* const realtimeSetup = RealtimeAudioSetup::createFromCommandLine (args);
+    streamer.setRealtimeSetup (realtimeSetup);
+
+    print (String::formatted (T("sweeping %d rates x %d buffer sizes, %.1fs of audio each, "),
+                              rates.size(), sizes.size(), secondsPerRun)
+            + (realTime ? T("real-time\n") : T("free-running\n")));
+
+    print (T("    rate  buffer  deadline_us   avg_us   p99_us   max_us  avg_load_%  headroom_%  overruns  latency_smp  latency_ms\n"));
+
+    int result = 0;
+
+    for (int r = 0; r < rates.size(); ++r)
+    {
+        for (int b = 0; b < sizes.size(); ++b)
+        {
+            const double sampleRate = rates[r].getDoubleValue();
+            const int bufferSize = sizes[b].getIntValue();
+
+            device.setMaxNumBlocks (jmax ((int64) 16, (int64) (secondsPerRun * sampleRate / bufferSize)));
+
+            const String error (device.open (ins, outs, sampleRate, bufferSize));
+
+            if (error.isNotEmpty())
+            {
+                print (error + T("\n"));
+                result = 1;
+                continue;
+            }
+
+            device.start (&streamer);
+            device.waitUntilFinished();
+            device.stop();
+
+            ProcessTimingHistogram::Summary s;
+            device.getCallbackTimings().getSummary (s);
+
+            const double deadline = jmax (0.001, s.nominalDeadlineMicros);
+
+            // the delay through the callback, plus the buffering that a real card would add
+            const int delay = device.getMeasuredCallbackDelay();
+            const int latency = delay < 0 ? -1
+                                          : delay + device.getInputLatencyInSamples() + device.getOutputLatencyInSamples();
+
+            device.close();
+
+            print (String::formatted (T("%8.0f  %6d  %11.1f  %7.2f  %7.2f  %7.2f  %10.2f  %10.1f  %8d  %11d  %10.2f\n"),
+                                      sampleRate, bufferSize, s.nominalDeadlineMicros,
+                                      s.meanMicros, s.p99Micros, s.maxMicros,
+                                      100.0 * s.meanLoad, 100.0 * (1.0 - s.p999Micros / deadline),
+                                      s.numOverruns, latency,
+                                      latency < 0 ? -1.0 : latency * 1000.0 / sampleRate));
+        }
+    }
+
+    streamer.setRealtimeSetup (0);
+
+    printChainSummary (filter);
+
+    if (realtimeSetup != 0)
+    {
+        print (realtimeSetup->getReport());
+        delete realtimeSetup;
+    }
+
+    return result;
+}
+
+//==============================================================================
+bool isHeadlessCommandLine (const StringArray& args)
+{
+    return hasFlag (args, T("--headless")) || hasFlag (args, T("--sweep"))
+             || hasFlag (args, T("--shm")) || hasFlag (args, T("--pipe"))
+             || hasFlag (args, T("--export"));
+}
+
+int runHeadlessStreamer (const StringArray& args)
+{
+    initialiseJuce_NonGUI();
+
+    messageStream = hasFlag (args, T("--pipe")) ? stderr : stdout;
+
+    int result = 1;
+    AudioProcessor* const filter = AudioProcessorChain::createForPlugin (getOption (args, T("--chain"), T("1")).getIntValue(),
+                                                                         hasFlag (args, T("--pipeline")));
+
+    if (filter == 0)
+        print (T("the filter couldn't be created\n"));
+    else if (applyParameters (args, *filter))
+    {
+        if (hasFlag (args, T("--sweep")))
+            result = runSweep (args, *filter);
+        else if (hasFlag (args, T("--shm")))
+            result = runSharedMemoryDevice (args, *filter);
+        else if (hasFlag (args, T("--pipe")))
+            result = runPipe (args, *filter);
+        else if (hasFlag (args, T("--export")))
+            result = runExport (args, *filter);
+        else
+            result = runNullDevice (args, *filter);
+    }
+
+    delete filter;
+
+    shutdownJuce_NonGUI();
+    return result;
+}
@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#ifndef __JUCE_HEADLESSSTREAMER_JUCEHEADER__
+#define __JUCE_HEADLESSSTREAMER_JUCEHEADER__
+
+#include <juce.h>
+
+
+//==============================================================================
+/*
+    Runs the standalone filter with no window and no sound card, streaming it
+    through a NullAudioIODevice and printing the callback timings at the end.
+
+    usage: <app> --headless [--rate 44100] [--buffer 512] [--inputs 2] [--outputs 2]
+                            [--seconds 10 | --blocks n] [--realtime]
+                            [--tone 440 | --silent] [--param index=value ...]
+                            [--input file.wav [--loop]] [--record file.wav]
+                            [--mlock] [--cpu n] [--fifo [priority]]
+                            [--metrics file.prom [--metrics-interval 10]]
+                            [--chain n] [--pipeline]
+
+    By default the device runs the filter as fast as it'll go, which measures
+    throughput. --realtime paces it to the sample rate instead, and reports how
+    late each callback was woken up, which measures the scheduling jitter.
+    --input plays a file into the filter instead of the tone, read ahead the
+    same way the standalone window does it, and without --loop or a length it
+    runs for as long as the file lasts. --record captures the output, also the
+    way the window does, so in free-running mode it'll show how much a real-time
+    recorder would drop. --mlock, --cpu and --fifo set up the audio thread as
+    described in RealtimeAudioSetup, and what did and didn't work is printed with
+    the results; at small buffer sizes, compare the lateness with and without them.
+    --metrics keeps a file of the callback counters up to date while it runs, in
+    the same way as the standalone window does when it's given that option.
+    --chain runs n instances of the filter one after another, as an
+    AudioProcessorChain, and --pipeline gives each of them a thread of its own;
+    their parameters are numbered one stage after another. The latency that
+    pipelining adds is printed with the results. A pipeline needs --realtime,
+    because a free-running device doesn't give the workers time to keep up, and
+    --fifo gives the workers the audio thread's priority too.
+
+    usage: <app> --sweep [--rates 44100,48000] [--buffers 32,64,128] [--seconds 2]
+                         [--realtime] [--inputs 2] [--outputs 2] [--param index=value ...]
+                         [--mlock] [--cpu n] [--fifo [priority]] [--chain n] [--pipeline]
+
+    The sweep runs the filter at each combination of rate and buffer size (by
+    default, all the ones the null device lists) and prints a row for each: the
+    callback times, the average load, the headroom (the proportion of the deadline
+    left over by the slowest 0.1% of callbacks), any overruns, and the input to
+    output latency. That's the delay of a step through the callback, measured with
+    the null device's latency probe, plus the block of input and block of output
+    buffering that a double-buffered card would add; it can't see any latency
+    that the real hardware adds on top. A latency of -1 means the step never came
+    out, e.g. because the parameters quantise it away.
+
+    usage: <app> --shm [name] [--rate 44100] [--buffer 256] [--inputs 2] [--outputs 2]
+                       [--slots 4] [--seconds n] [--param index=value ...]
+                       [--mlock] [--cpu n] [--fifo [priority]]
+                       [--metrics file.prom [--metrics-interval 10]] [--chain n] [--pipeline]
+
+    This serves the filter to another process through a SharedMemoryAudioIODevice
+    (the segment's called /kitty unless a name's given), which takes the place
+    of the sound card. It runs until a client has attached and detached again,
+    or for --seconds if that comes first, or until it's interrupted, and then
+    prints the callback timings. --slots is rounded up to a power of two.
+    tools/kittyShmClient.cpp is a client for it.
+
+    usage: <app> --pipe [--format f32|s16|s24|s32] [--channels 2] [--rate 44100]
+                        [--buffer 4096] [--param index=value ...] [--chain n] [--pipeline]
+
+    This reads interleaved little-endian raw PCM from stdin, runs it through the
+    filter and writes it to stdout in the same format, through a PipeAudioIODevice,
+    so it can go in the middle of a shell pipeline, e.g.
+        sox in.flac -t f32 - | <app> --pipe | sox -t f32 -r 44100 -c 2 - out.wav
+    The rate isn't read from the stream, so it has to be given if it's not 44100.
+    It stops when stdin ends (or stdout's closed), and everything that would
+    normally be printed goes to stderr instead, including how much of the time
+    was spent waiting for the pipes.
+
+    usage: <app> --export source.wav dest.wav [--pack] [--param index=value ...]
+
+    For a plugin that defines JucePlugin_HasReducedRateExport, this renders a
+    file offline through the plugin's own exportPluginFilterAtReducedRate(), which
+    can write fewer samples than it reads - e.g. only the ones that a decimator
+    holds, at the rate it holds them - and prints what it did. --pack asks it to
+    write the samples at the bit depth that the filter's set to, rather than at
+    32 bits.
+
+    This only needs the non-gui parts of juce, so it works without a display.
+*/
+
+/** Returns true if the command line asks for one of the modes that run without a window. */
+bool isHeadlessCommandLine (const StringArray& args);
+
+/** Runs the mode that the command line asks for, and returns the process's exit code. */
+int runHeadlessStreamer (const StringArray& args);
+
+
+#endif   // __JUCE_HEADLESSSTREAMER_JUCEHEADER__
@@ -0,0 +1,456 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#include "juce_NullAudioIODevice.h"
+
+
+//==============================================================================
+NullAudioIODevice::NullAudioIODevice (const int numInputChannels, const int numOutputChannels)
+    : AudioIODevice (T("Null"), T("Null")),
+      Thread (T("Null audio device")),
+      numInputs (jmax (0, numInputChannels)),
+      numOutputs (jmax (0, numOutputChannels)),
+      pacing (freeRunning),
+      toneFrequency (440.0),
+      toneGain (0.5f),
+      probing (false),
+      maxNumBlocks (0),
+      deviceIsOpen (false),
+      currentSampleRate (44100.0),
+      currentBufferSize (512),
+      callback (0),
+      toneTable (1, 32),
+      probeBuffer (1, 32),
+      outputBuffer (1, 32),
+      toneTableLength (1),
+      inputPointers (0),
+      outputPointers (0),
+      numBlocksDone (0),
+      startTime (0),
+      lastBlockTime (0),
+      totalLatenessTicks (0),
+      maxLatenessTicks (0),
+      numXRuns (0),
+      probeStepPosition (0),
+      measuredDelay (-1)
+{
+}
+
+NullAudioIODevice::~NullAudioIODevice()
+{
+    close();
+}
+
+//==============================================================================
+void NullAudioIODevice::setPacing (const Pacing newPacing)
+{
+    jassert (! isThreadRunning());
+    pacing = newPacing;
+}
+
+void NullAudioIODevice::setInputTone (const double frequencyHz, const float gain)
+{
+    toneFrequency = frequencyHz;
+    toneGain = gain;
+}
+
+void NullAudioIODevice::setLatencyProbe (const bool shouldProbe)
+{
+    jassert (! isThreadRunning());
+    probing = shouldProbe;
+}
+
+void NullAudioIODevice::setMaxNumBlocks (const int64 maxBlocks)
+{
+    maxNumBlocks = jmax ((int64) 0, maxBlocks);
+}
+
+bool NullAudioIODevice::waitUntilFinished (const int timeOutMilliseconds)
+{
+    return finishedEvent.wait (timeOutMilliseconds);
+}
+
+double NullAudioIODevice::getSecondsRunning() const throw()
+{
+    return (lastBlockTime - startTime) / (double) Time::getHighResolutionTicksPerSecond();
+}
+
+double NullAudioIODevice::getMeanLatenessMs() const throw()
+{
+    return numBlocksDone > 0 ? (totalLatenessTicks * 1000.0) / ((double) Time::getHighResolutionTicksPerSecond() * numBlocksDone)
+                             : 0.0;
+}
+
+double NullAudioIODevice::getMaxLatenessMs() const throw()
+{
+    return maxLatenessTicks * 1000.0 / (double) Time::getHighResolutionTicksPerSecond();
+}
+
+//==============================================================================
+const StringArray NullAudioIODevice::getOutputChannelNames()
+{
+    StringArray names;
+
+    for (int i = 0; i < numOutputs; ++i)
+        names.add (T("Null output ") + String (i + 1));
+
+    return names;
+}
+
+const StringArray NullAudioIODevice::getInputChannelNames()
+{
+    StringArray names;
+
+    for (int i = 0; i < numInputs; ++i)
+        names.add (T("Null input ") + String (i + 1));
+
+    return names;
+}
+
+static const double nullDeviceSampleRates[] = { 22050.0, 32000.0, 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+static const int nullDeviceBufferSizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+
+int NullAudioIODevice::getNumSampleRates()
+{
+    return numElementsInArray (nullDeviceSampleRates);
+}
+
+double NullAudioIODevice::getSampleRate (int index)
+{
+    return nullDeviceSampleRates [jlimit (0, getNumSampleRates() - 1, index)];
+}
+
+int NullAudioIODevice::getNumBufferSizesAvailable()
+{
+    return numElementsInArray (nullDeviceBufferSizes);
+}
+
+int NullAudioIODevice::getBufferSizeSamples (int index)
+{
+    return nullDeviceBufferSizes [jlimit (0, getNumBufferSizesAvailable() - 1, index)];
+}
+
+int NullAudioIODevice::getDefaultBufferSize()
+{
+    return 512;
+}
+
+//==============================================================================
+const String NullAudioIODevice::open (const BitArray& inputChannels,
+                                      const BitArray& outputChannels,
+                                      double sampleRate,
+                                      int bufferSizeSamples)
+{
+    close();
+
+    // (any rate and size will do, not just the ones in the lists)
+    if (sampleRate <= 0 || bufferSizeSamples <= 0)
+        return T("The null device needs a positive sample rate and buffer size");
+
+    currentSampleRate = sampleRate;
+    currentBufferSize = bufferSizeSamples;
+
+    activeInputs.clear();
+    activeOutputs.clear();
+
+    int i;
+    for (i = 0; i < numInputs; ++i)
+        if (inputChannels [i])
+            activeInputs.setBit (i);
+
+    for (i = 0; i < numOutputs; ++i)
+        if (outputChannels [i])
+            activeOutputs.setBit (i);
+
+    // The tone is a second long and a whole number of cycles, so it loops cleanly,
+    // plus a block's worth of overlap at the end. Each block's inputs then just
+    // point into it, and nothing has to be generated while the device is running.
+    toneTableLength = jmax (1, roundDoubleToInt (sampleRate));
+    const int numCycles = roundDoubleToInt (toneFrequency * toneTableLength / sampleRate);
+
+    toneTable.setSize (1, toneTableLength + bufferSizeSamples);
+
+    for (i = 0; i < toneTableLength + bufferSizeSamples; ++i)
+        *toneTable.getSampleData (0, i) = toneGain * (float) sin (2.0 * double_Pi * numCycles * (i % toneTableLength) / toneTableLength);
+
+    probeBuffer.setSize (1, bufferSizeSamples);
+    probeBuffer.clear();
+
+    outputBuffer.setSize (jmax (1, numOutputs), bufferSizeSamples);
+    outputBuffer.clear();
+
+    inputPointers = (const float**) juce_calloc (sizeof (float*) * (numInputs + 1));
+    outputPointers = (float**) juce_calloc (sizeof (float*) * (numOutputs + 1));
+
+    for (i = 0; i < numOutputs; ++i)
+        if (activeOutputs [i])
+            outputPointers[i] = outputBuffer.getSampleData (i, 0);
+
+    deviceIsOpen = true;
+    return String::empty;
+}
+
+void NullAudioIODevice::close()
+{
+    stop();
+
+    juce_free (inputPointers);
+    inputPointers = 0;
+    juce_free (outputPointers);
+    outputPointers = 0;
+
+    toneTable.setSize (1, 32);
+    probeBuffer.setSize (1, 32);
+    outputBuffer.setSize (1, 32);
+    deviceIsOpen = false;
+}
+
+bool NullAudioIODevice::isOpen()
+{
+    return deviceIsOpen;
+}
+
+void NullAudioIODevice::start (AudioIODeviceCallback* newCallback)
+{
+    if (! deviceIsOpen || newCallback == 0)
+        return;
+
+    stop();
+
+    newCallback->audioDeviceAboutToStart (this);
+
+    numBlocksDone = 0;
+    totalLatenessTicks = maxLatenessTicks = 0;
+    numXRuns = 0;
+    measuredDelay = -1;
+
+    // (a couple of blocks in, and not on a block boundary, so that a callback
+    //  that only looks at whole blocks will show up)
+    probeStepPosition = currentBufferSize * 2 + currentBufferSize / 3 + 1;
+
+    callbackTimings.setPlayConfig (currentSampleRate, currentBufferSize);
+    callbackTimings.reset();
+    finishedEvent.reset();
+
+    {
+        const ScopedLock sl (callbackLock);
+        callback = newCallback;
+    }
+
+    startThread (9);
+}
+
+void NullAudioIODevice::stop()
+{
+    stopThread (5000);
+
+    AudioIODeviceCallback* lastCallback;
+
+    {
+        const ScopedLock sl (callbackLock);
+        lastCallback = callback;
+        callback = 0;
+    }
+
+    if (lastCallback != 0)
+        lastCallback->audioDeviceStopped();
+}
+
+bool NullAudioIODevice::isPlaying()
+{
+    return callback != 0;
+}
+
+const String NullAudioIODevice::getLastError()
+{
+    return String::empty;
+}
+
+int NullAudioIODevice::getCurrentBufferSizeSamples()
+{
+    return currentBufferSize;
+}
+
+double NullAudioIODevice::getCurrentSampleRate()
+{
+    return currentSampleRate;
+}
+
+int NullAudioIODevice::getCurrentBitDepth()
+{
+    return 32;
+}
+
+const BitArray NullAudioIODevice::getActiveOutputChannels() const
+{
+    return activeOutputs;
+}
+
+const BitArray NullAudioIODevice::getActiveInputChannels() const
+{
+    return activeInputs;
+}
+
+int NullAudioIODevice::getOutputLatencyInSamples()
+{
+    // (the block being played while the next one is worked out)
+    return currentBufferSize;
+}
+
+int NullAudioIODevice::getInputLatencyInSamples()
+{
+    // (the block being recorded while the last one is worked out)
+    return currentBufferSize;
+}
+
+//==============================================================================
+void NullAudioIODevice::findProbeStep (const int64 blockStart)
+{
+    for (int i = 0; i < numOutputs; ++i)
+    {
+        if (outputPointers[i] != 0)
+        {
+            const float* const out = outputPointers[i];
+
+            // (anything before the step went in doesn't count)
+            for (int j = (int) jmax ((int64) 0, probeStepPosition - blockStart); j < currentBufferSize; ++j)
+            {
+                if (fabsf (out[j]) > 0.1f)
+                {
+                    measuredDelay = (int) (blockStart + j - probeStepPosition);
+                    break;
+                }
+            }
+
+            break;
+        }
+    }
+}
+
+void NullAudioIODevice::run()
+{
+    const double ticksPerSecond = (double) Time::getHighResolutionTicksPerSecond();
+    const double ticksPerBlock = ticksPerSecond * currentBufferSize / currentSampleRate;
+
+    int64 scheduleStart = Time::getHighResolutionTicks();
+    int64 numBlocksScheduled = 0;
+    int tonePosition = 0;
+
+    startTime = lastBlockTime = scheduleStart;
+
+    while (! threadShouldExit())
+    {
+        int64 now = Time::getHighResolutionTicks();
+
+        if (pacing == realTime)
+        {
+            const int64 due = scheduleStart + (int64) (numBlocksScheduled * ticksPerBlock);
+
+            // sleep for most of the wait and spin for the last couple of milliseconds,
+            // because a sleep can easily overshoot by that much
+            while (now < due)
+            {
+                const double msToWait = (due - now) * 1000.0 / ticksPerSecond;
+
+                if (msToWait > 2.0)
+                    Thread::sleep ((int) msToWait - 1);
+                else
+                    Thread::yield();
+
+                now = Time::getHighResolutionTicks();
+            }
+
+            if (threadShouldExit())
+                break;
+
+            const int64 lateness = now - due;
+            totalLatenessTicks += lateness;
+
+            if (lateness > maxLatenessTicks)
+                maxLatenessTicks = lateness;
+
+            if (lateness > ticksPerBlock)
+            {
+                // a sound card would have dropped out here, and then carried on from now
+                ++numXRuns;
+                scheduleStart = now;
+                numBlocksScheduled = 0;
+            }
+        }
+
+        const int64 blockStart = numBlocksDone * currentBufferSize;
+        const float* input = toneTable.getSampleData (0, tonePosition);
+        int i;
+
+        if (probing)
+        {
+            float* const step = probeBuffer.getSampleData (0, 0);
+
+            for (i = 0; i < currentBufferSize; ++i)
+                step[i] = (blockStart + i >= probeStepPosition) ? 0.5f : 0.0f;
+
+            input = step;
+        }
+
+        for (i = 0; i < numInputs; ++i)
+            inputPointers[i] = activeInputs [i] ? input : 0;
+
+        const int64 callbackStart = ProcessTimingHistogram::getStartTime();
+
+        {
+            const ScopedLock sl (callbackLock);
+
+            if (callback != 0)
+                callback->audioDeviceIOCallback (inputPointers, numInputs,
+                                                 outputPointers, numOutputs,
+                                                 currentBufferSize);
+        }
+
+        callbackTimings.addCallback (callbackStart, currentBufferSize);
+
+        if (probing && measuredDelay < 0 && blockStart + currentBufferSize > probeStepPosition)
+            findProbeStep (blockStart);
+
+        tonePosition += currentBufferSize;
+
+        while (tonePosition >= toneTableLength)
+            tonePosition -= toneTableLength;
+
+        ++numBlocksScheduled;
+        lastBlockTime = Time::getHighResolutionTicks();
+
+        if (++numBlocksDone == maxNumBlocks)
+        {
+            finishedEvent.signal();
+            break;
+        }
+    }
+}
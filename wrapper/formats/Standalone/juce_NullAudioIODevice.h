@@ -0,0 +1,186 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#ifndef __JUCE_NULLAUDIOIODEVICE_JUCEHEADER__
+#define __JUCE_NULLAUDIOIODEVICE_JUCEHEADER__
+
+#include <juce.h>
+#include "../../juce_ProcessTimingHistogram.h"
+
+
+//==============================================================================
+/**
+    An AudioIODevice that isn't connected to any hardware.
+
+    It calls its callback from its own thread, either as fast as the callback
+    can go (to measure throughput), or paced to the sample rate like a real
+    sound card would be (to measure scheduling jitter). The inputs play a sine
+    tone, or silence, and the outputs are thrown away.
+
+    It times every callback, and in real-time mode it also records how late
+    each one started compared with when a sound card would have asked for it.
+    If a callback starts more than a whole block late, that's counted as an
+    xrun and the schedule starts again from there, as a device would.
+
+    It reports a block of input latency and a block of output latency, which is
+    the least that a double-buffered sound card would have. In latency-probe
+    mode, the inputs play a step instead of the tone, and the device watches
+    its outputs for it, so it can measure the callback's own delay on top.
+*/
+class NullAudioIODevice  : public AudioIODevice,
+                           private Thread
+{
+public:
+    //==============================================================================
+    NullAudioIODevice (const int numInputChannels, const int numOutputChannels);
+    ~NullAudioIODevice();
+
+    //==============================================================================
+    enum Pacing
+    {
+        freeRunning,    /**< each callback starts as soon as the last one finishes. */
+        realTime        /**< callbacks happen at the rate a sound card would make them. */
+    };
+
+    /** Changes the pacing. This can only be done while the device is stopped. */
+    void setPacing (const Pacing newPacing);
+
+    /** Sets the tone that the inputs play. A gain of 0 makes them silent.
+        This takes effect the next time the device is opened.
+    */
+    void setInputTone (const double frequencyHz, const float gain);
+
+    /** Makes the inputs play a step (from silence to half scale, a few blocks in)
+        instead of the tone, and measures how long it takes to reach the outputs.
+        This takes effect the next time the device is started.
+    */
+    void setLatencyProbe (const bool shouldProbe);
+
+    /** In latency-probe mode, returns the number of samples between the step going
+        into the callback and it coming out of the first output, or -1 if it hasn't
+        come out (yet). This doesn't include the device's own input and output latency.
+    */
+    int getMeasuredCallbackDelay() const throw()            { return measuredDelay; }
+
+    /** Makes the device stop calling back after a number of blocks. 0 means keep going. */
+    void setMaxNumBlocks (const int64 maxBlocks);
+
+    /** Waits until the device has done its maximum number of blocks, or the timeout
+        expires. Returns true if it finished.
+    */
+    bool waitUntilFinished (const int timeOutMilliseconds = -1);
+
+    //==============================================================================
+    /** The durations of the callbacks since the device was last started. */
+    const ProcessTimingHistogram& getCallbackTimings() const throw()     { return callbackTimings; }
+
+    /** The number of blocks done since the device was last started. */
+    int64 getNumBlocksDone() const throw()                  { return numBlocksDone; }
+
+    /** The number of seconds between the device starting and it doing its last block. */
+    double getSecondsRunning() const throw();
+
+    /** In real-time mode, the average and worst lateness of a callback, in milliseconds. */
+    double getMeanLatenessMs() const throw();
+    double getMaxLatenessMs() const throw();
+
+    /** In real-time mode, the number of callbacks that started more than a block late. */
+    int getNumXRuns() const throw()                         { return numXRuns; }
+
+    //==============================================================================
+    const StringArray getOutputChannelNames();
+    const StringArray getInputChannelNames();
+    int getNumSampleRates();
+    double getSampleRate (int index);
+    int getNumBufferSizesAvailable();
+    int getBufferSizeSamples (int index);
+    int getDefaultBufferSize();
+
+    const String open (const BitArray& inputChannels,
+                       const BitArray& outputChannels,
+                       double sampleRate,
+                       int bufferSizeSamples);
+    void close();
+    bool isOpen();
+
+    void start (AudioIODeviceCallback* callback);
+    void stop();
+    bool isPlaying();
+
+    const String getLastError();
+    int getCurrentBufferSizeSamples();
+    double getCurrentSampleRate();
+    int getCurrentBitDepth();
+    const BitArray getActiveOutputChannels() const;
+    const BitArray getActiveInputChannels() const;
+    int getOutputLatencyInSamples();
+    int getInputLatencyInSamples();
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    const int numInputs, numOutputs;
+    Pacing pacing;
+    double toneFrequency;
+    float toneGain;
+    bool probing;
+    int64 maxNumBlocks;
+
+    bool deviceIsOpen;
+    double currentSampleRate;
+    int currentBufferSize;
+    BitArray activeInputs, activeOutputs;
+
+    CriticalSection callbackLock;
+    AudioIODeviceCallback* callback;
+
+    AudioSampleBuffer toneTable, probeBuffer, outputBuffer;
+    int toneTableLength;
+    const float** inputPointers;
+    float** outputPointers;
+
+    WaitableEvent finishedEvent;
+    ProcessTimingHistogram callbackTimings;
+    volatile int64 numBlocksDone, startTime, lastBlockTime, totalLatenessTicks, maxLatenessTicks;
+    volatile int numXRuns;
+    int64 probeStepPosition;
+    volatile int measuredDelay;
+
+    void run();
+    void findProbeStep (const int64 blockStart);
+
+    NullAudioIODevice (const NullAudioIODevice&);
+    const NullAudioIODevice& operator= (const NullAudioIODevice&);
+};
+
+
+#endif   // __JUCE_NULLAUDIOIODEVICE_JUCEHEADER__
@@ -0,0 +1,507 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#include "juce_PipeAudioIODevice.h"
+#include "../../juce_LockFreeFifo.h"
+
+
+//==============================================================================
+class PipeAudioIODevice::IOThread  : public Thread
+{
+public:
+    IOThread (PipeAudioIODevice& owner_)
+        : Thread (T("Pipe audio i/o")),
+          owner (owner_)
+    {
+    }
+
+    void run()
+    {
+        owner.runIO (*this);
+    }
+
+private:
+    PipeAudioIODevice& owner;
+
+    IOThread (const IOThread&);
+    const IOThread& operator= (const IOThread&);
+};
+
+//==============================================================================
+bool PipeAudioIODevice::parseSampleFormat (const String& name, SampleFormat& result)
+{
+    if (name == T("f32"))       result = float32;
+    else if (name == T("s16"))  result = int16;
+    else if (name == T("s24"))  result = int24;
+    else if (name == T("s32"))  result = int32;
+    else                        return false;
+
+    return true;
+}
+
+static int getBytesPerSample (const PipeAudioIODevice::SampleFormat format)
+{
+    return format == PipeAudioIODevice::int16 ? 2
+                                              : (format == PipeAudioIODevice::int24 ? 3 : 4);
+}
+
+//==============================================================================
+PipeAudioIODevice::PipeAudioIODevice (FILE* inputStream_,
+                                      FILE* outputStream_,
+                                      const int numChannels_,
+                                      const SampleFormat format_)
+    : AudioIODevice (T("Pipe"), T("Pipe")),
+      Thread (T("Pipe audio device")),
+      inputStream (inputStream_),
+      outputStream (outputStream_),
+      numChannels (jmax (1, numChannels_)),
+      format (format_),
+      bytesPerSample (getBytesPerSample (format_)),
+      deviceIsOpen (false),
+      currentSampleRate (44100.0),
+      currentBufferSize (4096),
+      callback (0),
+      buffer (1, 32),
+      channels (0),
+      ioThread (0),
+      ioFinished (false),
+      numFramesWritten (0),
+      startTime (0),
+      endTime (0),
+      ticksWaitingForIO (0)
+{
+    for (int i = 0; i < numElementsInArray (slots); ++i)
+    {
+        slots[i].numFrames = slots[i].numFramesToWrite = 0;
+        slots[i].ownedByIOThread = true;
+    }
+}
+
+PipeAudioIODevice::~PipeAudioIODevice()
+{
+    close();
+}
+
+//==============================================================================
+bool PipeAudioIODevice::waitUntilFinished (const int timeOutMilliseconds)
+{
+    return finishedEvent.wait (timeOutMilliseconds);
+}
+
+double PipeAudioIODevice::getSecondsRunning() const throw()
+{
+    const int64 end = endTime != 0 ? endTime : Time::getHighResolutionTicks();
+
+    return startTime == 0 ? 0.0 : (end - startTime) / (double) Time::getHighResolutionTicksPerSecond();
+}
+
+double PipeAudioIODevice::getProportionOfTimeWaitingForIO() const throw()
+{
+    const double seconds = getSecondsRunning();
+
+    return seconds > 0 ? ticksWaitingForIO / (double) Time::getHighResolutionTicksPerSecond() / seconds
+                       : 0.0;
+}
+
+//==============================================================================
+const StringArray PipeAudioIODevice::getOutputChannelNames()
+{
+    StringArray names;
+
+    for (int i = 0; i < numChannels; ++i)
+        names.add (T("Pipe output ") + String (i + 1));
+
+    return names;
+}
+
+const StringArray PipeAudioIODevice::getInputChannelNames()
+{
+    StringArray names;
+
+    for (int i = 0; i < numChannels; ++i)
+        names.add (T("Pipe input ") + String (i + 1));
+
+    return names;
+}
+
+static const double pipeDeviceSampleRates[] = { 22050.0, 32000.0, 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+static const int pipeDeviceBufferSizes[] = { 512, 1024, 2048, 4096, 8192, 16384 };
+
+int PipeAudioIODevice::getNumSampleRates()
+{
+    return numElementsInArray (pipeDeviceSampleRates);
+}
+
+double PipeAudioIODevice::getSampleRate (int index)
+{
+    return pipeDeviceSampleRates [jlimit (0, getNumSampleRates() - 1, index)];
+}
+
+int PipeAudioIODevice::getNumBufferSizesAvailable()
+{
+    return numElementsInArray (pipeDeviceBufferSizes);
+}
+
+int PipeAudioIODevice::getBufferSizeSamples (int index)
+{
+    return pipeDeviceBufferSizes [jlimit (0, getNumBufferSizesAvailable() - 1, index)];
+}
+
+int PipeAudioIODevice::getDefaultBufferSize()
+{
+    // (big blocks, so that the per-block overheads are lost in the noise)
+    return 4096;
+}
+
+//==============================================================================
+const String PipeAudioIODevice::open (const BitArray& inputChannels,
+                                      const BitArray& outputChannels,
+                                      double sampleRate,
+                                      int bufferSizeSamples)
+{
+    close();
+    lastError = String::empty;
+
+    if (sampleRate <= 0 || bufferSizeSamples <= 0)
+    {
+        lastError = T("The pipe device needs a positive sample rate and buffer size");
+        return lastError;
+    }
+
+    if (inputStream == 0 || outputStream == 0)
+    {
+        lastError = T("The pipe device needs an input and an output stream");
+        return lastError;
+    }
+
+    currentSampleRate = sampleRate;
+    currentBufferSize = bufferSizeSamples;
+
+    // every channel's read and written, whichever ones are asked for, because
+    // they're all in the stream
+    (void) inputChannels;
+    (void) outputChannels;
+    activeChannels.clear();
+    activeChannels.setRange (0, numChannels, true);
+
+    for (int i = 0; i < numElementsInArray (slots); ++i)
+    {
+        slots[i].data.setSize (bufferSizeSamples * numChannels * bytesPerSample, true);
+        slots[i].numFrames = slots[i].numFramesToWrite = 0;
+        slots[i].ownedByIOThread = true;
+    }
+
+    buffer.setSize (numChannels, bufferSizeSamples);
+    buffer.clear();
+
+    channels = (float**) juce_calloc (sizeof (float*) * (numChannels + 1));
+
+    for (int i = 0; i < numChannels; ++i)
+        channels[i] = buffer.getSampleData (i, 0);
+
+    deviceIsOpen = true;
+    return String::empty;
+}
+
+void PipeAudioIODevice::close()
+{
+    stop();
+
+    for (int i = 0; i < numElementsInArray (slots); ++i)
+        slots[i].data.setSize (0);
+
+    buffer.setSize (1, 32);
+
+    juce_free (channels);
+    channels = 0;
+    deviceIsOpen = false;
+}
+
+bool PipeAudioIODevice::isOpen()
+{
+    return deviceIsOpen;
+}
+
+void PipeAudioIODevice::start (AudioIODeviceCallback* newCallback)
+{
+    if (! deviceIsOpen || newCallback == 0)
+        return;
+
+    stop();
+
+    newCallback->audioDeviceAboutToStart (this);
+
+    for (int i = 0; i < numElementsInArray (slots); ++i)
+    {
+        slots[i].numFrames = slots[i].numFramesToWrite = 0;
+        slots[i].ownedByIOThread = true;
+    }
+
+    ioFinished = false;
+    numFramesWritten = 0;
+    ticksWaitingForIO = 0;
+    endTime = 0;
+    startTime = Time::getHighResolutionTicks();
+    ioEvent.reset();
+    processEvent.reset();
+    finishedEvent.reset();
+
+    {
+        const ScopedLock sl (callbackLock);
+        callback = newCallback;
+    }
+
+    ioThread = new IOThread (*this);
+    ioThread->startThread (7);
+    startThread (9);
+}
+
+void PipeAudioIODevice::stop()
+{
+    signalThreadShouldExit();
+
+    if (ioThread != 0)
+    {
+        // (if it's blocked reading a pipe that never ends, this is as good as it gets)
+        ioThread->stopThread (5000);
+        delete ioThread;
+        ioThread = 0;
+    }
+
+    stopThread (5000);
+
+    AudioIODeviceCallback* lastCallback;
+
+    {
+        const ScopedLock sl (callbackLock);
+        lastCallback = callback;
+        callback = 0;
+    }
+
+    if (lastCallback != 0)
+        lastCallback->audioDeviceStopped();
+}
+
+bool PipeAudioIODevice::isPlaying()
+{
+    return callback != 0;
+}
+
+const String PipeAudioIODevice::getLastError()
+{
+    return lastError;
+}
+
+int PipeAudioIODevice::getCurrentBufferSizeSamples()
+{
+    return currentBufferSize;
+}
+
+double PipeAudioIODevice::getCurrentSampleRate()
+{
+    return currentSampleRate;
+}
+
+int PipeAudioIODevice::getCurrentBitDepth()
+{
+    return bytesPerSample * 8;
+}
+
+const BitArray PipeAudioIODevice::getActiveOutputChannels() const
+{
+    return activeChannels;
+}
+
+const BitArray PipeAudioIODevice::getActiveInputChannels() const
+{
+    return activeChannels;
+}
+
+int PipeAudioIODevice::getOutputLatencyInSamples()
+{
+    // (the block being written while the next one is worked out)
+    return currentBufferSize;
+}
+
+int PipeAudioIODevice::getInputLatencyInSamples()
+{
+    // (the block being read while the last one is worked out)
+    return currentBufferSize;
+}
+
+//==============================================================================
+void PipeAudioIODevice::convertFromRaw (const void* source, const int numFrames)
+{
+    const int stride = numChannels * bytesPerSample;
+
+    for (int i = 0; i < numChannels; ++i)
+    {
+        const char* const src = ((const char*) source) + i * bytesPerSample;
+
+        switch (format)
+        {
+            case int16:     AudioDataConverters::convertInt16LEToFloat (src, channels[i], numFrames, stride); break;
+            case int24:     AudioDataConverters::convertInt24LEToFloat (src, channels[i], numFrames, stride); break;
+            case int32:     AudioDataConverters::convertInt32LEToFloat (src, channels[i], numFrames, stride); break;
+            default:        AudioDataConverters::convertFloat32LEToFloat (src, channels[i], numFrames, stride); break;
+        }
+
+        // (a short last block is padded with silence)
+        if (numFrames < currentBufferSize)
+            zeromem (channels[i] + numFrames, sizeof (float) * (currentBufferSize - numFrames));
+    }
+}
+
+void PipeAudioIODevice::convertToRaw (void* dest, const int numFrames) const
+{
+    const int stride = numChannels * bytesPerSample;
+
+    for (int i = 0; i < numChannels; ++i)
+    {
+        char* const dst = ((char*) dest) + i * bytesPerSample;
+
+        switch (format)
+        {
+            case int16:     AudioDataConverters::convertFloatToInt16LE (channels[i], dst, numFrames, stride); break;
+            case int24:     AudioDataConverters::convertFloatToInt24LE (channels[i], dst, numFrames, stride); break;
+            case int32:     AudioDataConverters::convertFloatToInt32LE (channels[i], dst, numFrames, stride); break;
+            default:        AudioDataConverters::convertFloatToFloat32LE (channels[i], dst, numFrames, stride); break;
+        }
+    }
+}
+
+//==============================================================================
+void PipeAudioIODevice::runIO (Thread& thread)
+{
+    const int bytesPerFrame = numChannels * bytesPerSample;
+    bool inputFinished = false;
+
+    // Each slot in turn: write out what the callback made of the block that was
+    // in it last time round, then read the next block into it and hand it over.
+    // Once the input's run out, the other slot still has a block to be written.
+    for (int64 blockNumber = 0;; ++blockNumber)
+    {
+        Slot& slot = slots [blockNumber & 1];
+
+        while (! slot.ownedByIOThread)
+        {
+            if (thread.threadShouldExit())
+                return;
+
+            ioEvent.wait (100);
+        }
+
+        // (the event's only a wake-up, and isn't waited on if the slot's already ours,
+        // so this is what stops the samples being read before the flag's been seen)
+        lockFreeMemoryBarrier();
+
+        const int numToWrite = slot.numFramesToWrite;
+
+        if (numToWrite > 0)
+        {
+            if ((int) fwrite (slot.data.getData(), bytesPerFrame, numToWrite, outputStream) != numToWrite)
+            {
+                lastError = T("The output was closed");
+                break;
+            }
+
+            slot.numFramesToWrite = 0;
+            numFramesWritten += numToWrite;
+        }
+
+        if (inputFinished)
+            break;
+
+        slot.numFrames = (int) fread (slot.data.getData(), bytesPerFrame, currentBufferSize, inputStream);
+
+        if (slot.numFrames == 0)
+            inputFinished = true;
+
+        lockFreeMemoryBarrier();
+        slot.ownedByIOThread = false;
+        processEvent.signal();
+    }
+
+    fflush (outputStream);
+
+    endTime = Time::getHighResolutionTicks();
+    ioFinished = true;
+    processEvent.signal();
+    finishedEvent.signal();
+}
+
+void PipeAudioIODevice::run()
+{
+    for (int64 blockNumber = 0; ! threadShouldExit(); ++blockNumber)
+    {
+        Slot& slot = slots [blockNumber & 1];
+
+        if (slot.ownedByIOThread)
+        {
+            const int64 waitStart = Time::getHighResolutionTicks();
+
+            while (slot.ownedByIOThread && ! (ioFinished || threadShouldExit()))
+                processEvent.wait (100);
+
+            ticksWaitingForIO += Time::getHighResolutionTicks() - waitStart;
+
+            if (slot.ownedByIOThread)
+                break;
+        }
+
+        lockFreeMemoryBarrier();
+
+        const int numFrames = slot.numFrames;
+
+        // (an empty block means the input's finished)
+        if (numFrames == 0)
+            break;
+
+        convertFromRaw (slot.data.getData(), numFrames);
+
+        {
+            const ScopedLock sl (callbackLock);
+
+            if (callback != 0)
+                callback->audioDeviceIOCallback ((const float**) channels, numChannels,
+                                                 channels, numChannels,
+                                                 currentBufferSize);
+        }
+
+        convertToRaw (slot.data.getData(), numFrames);
+
+        slot.numFramesToWrite = numFrames;
+        lockFreeMemoryBarrier();
+        slot.ownedByIOThread = true;
+        ioEvent.signal();
+    }
+}
@@ -0,0 +1,181 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#ifndef __JUCE_PIPEAUDIOIODEVICE_JUCEHEADER__
+#define __JUCE_PIPEAUDIOIODEVICE_JUCEHEADER__
+
+#include <juce.h>
+#include <stdio.h>
+
+
+//==============================================================================
+/**
+    An AudioIODevice that reads interleaved raw PCM from one stream (usually
+    stdin) and writes what the callback makes of it to another (usually
+    stdout), as fast as the streams will go.
+
+    There are two blocks in flight. A separate i/o thread writes out one block
+    and reads the next into the same slot while the device's own thread runs
+    the callback on the other, so the reading and writing overlap with the
+    processing. The callback's inputs and outputs are the same buffers, so the
+    only copying is the conversion to and from floats.
+
+    The last block is padded with silence if the input ends part way through
+    it, but only the samples that were read are written out. The device
+    finishes once the input's ended and everything's been written, or when
+    the output's closed.
+*/
+class PipeAudioIODevice  : public AudioIODevice,
+                           private Thread
+{
+public:
+    //==============================================================================
+    /** The little-endian sample formats that the device can read and write. */
+    enum SampleFormat
+    {
+        float32,
+        int16,
+        int24,
+        int32
+    };
+
+    /** Parses "f32", "s16", "s24" or "s32". Returns false if it's none of those. */
+    static bool parseSampleFormat (const String& name, SampleFormat& result);
+
+    //==============================================================================
+    /** Creates a device that reads from one stream and writes to another. The same
+        number of channels is read and written.
+    */
+    PipeAudioIODevice (FILE* inputStream,
+                       FILE* outputStream,
+                       const int numChannels,
+                       const SampleFormat format);
+
+    ~PipeAudioIODevice();
+
+    //==============================================================================
+    /** Waits until the input has ended and all the output's been written, or the
+        output's been closed, or the timeout expires. Returns true if it finished.
+    */
+    bool waitUntilFinished (const int timeOutMilliseconds = -1);
+
+    /** The number of sample frames written since the device was last started. */
+    int64 getNumFramesWritten() const throw()               { return numFramesWritten; }
+
+    /** The number of seconds between the device starting and it finishing. */
+    double getSecondsRunning() const throw();
+
+    /** The proportion of the time that the callback's thread spent waiting for the i/o
+        thread. Near 0 means the filter's the bottleneck; near 1 means the pipes are.
+    */
+    double getProportionOfTimeWaitingForIO() const throw();
+
+    //==============================================================================
+    const StringArray getOutputChannelNames();
+    const StringArray getInputChannelNames();
+    int getNumSampleRates();
+    double getSampleRate (int index);
+    int getNumBufferSizesAvailable();
+    int getBufferSizeSamples (int index);
+    int getDefaultBufferSize();
+
+    const String open (const BitArray& inputChannels,
+                       const BitArray& outputChannels,
+                       double sampleRate,
+                       int bufferSizeSamples);
+    void close();
+    bool isOpen();
+
+    void start (AudioIODeviceCallback* callback);
+    void stop();
+    bool isPlaying();
+
+    const String getLastError();
+    int getCurrentBufferSizeSamples();
+    double getCurrentSampleRate();
+    int getCurrentBitDepth();
+    const BitArray getActiveOutputChannels() const;
+    const BitArray getActiveInputChannels() const;
+    int getOutputLatencyInSamples();
+    int getInputLatencyInSamples();
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    FILE* const inputStream;
+    FILE* const outputStream;
+    const int numChannels;
+    const SampleFormat format;
+    const int bytesPerSample;
+
+    bool deviceIsOpen;
+    double currentSampleRate;
+    int currentBufferSize;
+    BitArray activeChannels;
+    String lastError;
+
+    CriticalSection callbackLock;
+    AudioIODeviceCallback* callback;
+
+    /** A block of raw data that belongs to one thread or the other. */
+    struct Slot
+    {
+        MemoryBlock data;
+        volatile int numFrames, numFramesToWrite;
+        volatile bool ownedByIOThread;
+    };
+
+    Slot slots [2];
+    AudioSampleBuffer buffer;
+    float** channels;
+
+    class IOThread;
+    friend class IOThread;
+    IOThread* ioThread;
+
+    WaitableEvent ioEvent, processEvent, finishedEvent;
+    volatile bool ioFinished;
+    volatile int64 numFramesWritten, startTime, endTime, ticksWaitingForIO;
+
+    void run();
+    void runIO (Thread& thread);
+
+    void convertFromRaw (const void* source, const int numFrames);
+    void convertToRaw (void* dest, const int numFrames) const;
+
+    PipeAudioIODevice (const PipeAudioIODevice&);
+    const PipeAudioIODevice& operator= (const PipeAudioIODevice&);
+};
+
+
+#endif   // __JUCE_PIPEAUDIOIODEVICE_JUCEHEADER__
@@ -0,0 +1,280 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#include "juce_RealtimeAudioSetup.h"
+
+#if JUCE_LINUX
+ #include <sys/mman.h>
+ #include <sched.h>
+ #include <malloc.h>
+ #include <errno.h>
+ #include <string.h>
+ #include <unistd.h>
+#endif
+
+#ifndef ENOSYS
+ #define ENOSYS 38
+#endif
+
+
+//==============================================================================
+// how much heap to prefault and keep hold of, and how much of the audio thread's stack
+static const int heapReserveBytes = 8 * 1024 * 1024;
+static const int stackReserveBytes = 256 * 1024;
+
+RealtimeAudioSetup::RealtimeAudioSetup()
+    : shouldLockMemory (false),
+      cpuToPinTo (-1),
+      fifoPriority (0),
+      memoryLockResult (notTried),
+      heapPrefaultResult (notTried),
+      affinityResult (notTried),
+      priorityResult (notTried),
+      numThreadsConfigured (0),
+      workerPriorityResult (notTried),
+      numPipelineWorkers (0)
+{
+}
+
+RealtimeAudioSetup::~RealtimeAudioSetup()
+{
+}
+
+RealtimeAudioSetup* RealtimeAudioSetup::createFromCommandLine (const StringArray& args)
+{
+    RealtimeAudioSetup* setup = 0;
+
+    for (int i = 0; i < args.size(); ++i)
+    {
+        const String arg (args[i]);
+
+        if (arg == T("--mlock") || arg == T("--cpu") || arg == T("--fifo"))
+        {
+            if (setup == 0)
+                setup = new RealtimeAudioSetup();
+
+            if (arg == T("--mlock"))
+            {
+                setup->setLockMemory (true);
+            }
+            else if (arg == T("--cpu"))
+            {
+                setup->setCpuToPinTo (args [i + 1].getIntValue());
+                ++i;
+            }
+            else
+            {
+                // (the priority's optional)
+                const int priority = args [i + 1].getIntValue();
+
+                if (priority > 0)
+                    ++i;
+
+                setup->setFifoPriority (priority > 0 ? priority : 70);
+            }
+        }
+    }
+
+    return setup;
+}
+
+//==============================================================================
+void RealtimeAudioSetup::lockMemory()
+{
+    if (! shouldLockMemory)
+        return;
+
+#if JUCE_LINUX
+    // Stop the allocator giving memory back to the system, or using separate
+    // mappings for big blocks, so anything that's been locked and freed is
+    // reused rather than mapped again.
+    mallopt (M_TRIM_THRESHOLD, -1);
+    mallopt (M_MMAP_MAX, 0);
+
+    memoryLockResult = (mlockall (MCL_CURRENT | MCL_FUTURE) == 0) ? 0 : errno;
+
+    // touch a reserve of heap, which then stays locked in the allocator's free list
+    char* const reserve = (char*) malloc (heapReserveBytes);
+
+    if (reserve != 0)
+    {
+        const int pageSize = (int) sysconf (_SC_PAGESIZE);
+
+        for (int i = 0; i < heapReserveBytes; i += pageSize)
+            reserve[i] = 0;
+
+        free (reserve);
+        heapPrefaultResult = 0;
+    }
+    else
+    {
+        heapPrefaultResult = ENOMEM;
+    }
+#else
+    memoryLockResult = heapPrefaultResult = ENOSYS;
+#endif
+}
+
+#if JUCE_LINUX
+static void prefaultStack()
+{
+    volatile char stack [stackReserveBytes];
+
+    for (int i = 0; i < stackReserveBytes; i += 1024)
+        stack[i] = 0;
+}
+#endif
+
+void RealtimeAudioSetup::applyToCurrentThread() throw()
+{
+#if JUCE_LINUX
+    const pthread_t thread = pthread_self();
+
+    if (numThreadsConfigured > 0 && pthread_equal (thread, configuredThread))
+        return;
+
+    configuredThread = thread;
+
+    if (cpuToPinTo >= 0)
+    {
+        cpu_set_t cpus;
+        CPU_ZERO (&cpus);
+        CPU_SET (cpuToPinTo % CPU_SETSIZE, &cpus);
+
+        affinityResult = pthread_setaffinity_np (thread, sizeof (cpus), &cpus);
+    }
+
+    if (fifoPriority > 0)
+    {
+        struct sched_param param;
+        zeromem (&param, sizeof (param));
+        param.sched_priority = jlimit (sched_get_priority_min (SCHED_FIFO),
+                                       sched_get_priority_max (SCHED_FIFO),
+                                       fifoPriority);
+
+        priorityResult = pthread_setschedparam (thread, SCHED_FIFO, &param);
+    }
+
+    if (shouldLockMemory)
+        prefaultStack();
+
+    ++numThreadsConfigured;
+#else
+    if (numThreadsConfigured == 0)
+    {
+        if (cpuToPinTo >= 0)
+            affinityResult = ENOSYS;
+
+        if (fifoPriority > 0)
+            priorityResult = ENOSYS;
+
+        ++numThreadsConfigured;
+    }
+#endif
+}
+
+void RealtimeAudioSetup::applyToWorkerThread (const int numWorkersInPipeline) throw()
+{
+#if JUCE_LINUX
+    if (fifoPriority > 0)
+    {
+        struct sched_param param;
+        zeromem (&param, sizeof (param));
+        param.sched_priority = jlimit (sched_get_priority_min (SCHED_FIFO),
+                                       sched_get_priority_max (SCHED_FIFO),
+                                       fifoPriority);
+
+        const int result = pthread_setschedparam (pthread_self(), SCHED_FIFO, &param);
+
+        // (if any of them fail, that's what gets reported)
+        if (result != 0 || workerPriorityResult == notTried)
+            workerPriorityResult = result;
+    }
+
+    if (shouldLockMemory)
+        prefaultStack();
+#else
+    if (fifoPriority > 0)
+        workerPriorityResult = ENOSYS;
+#endif
+
+    numPipelineWorkers = numWorkersInPipeline;
+}
+
+//==============================================================================
+static const String describeResult (const String& what, const int result)
+{
+    if (result == 0)
+        return what + T(": yes\n");
+
+    if (result < 0)
+        return what + T(": not tried yet\n");
+
+    String reason;
+
+#if JUCE_LINUX
+    reason = strerror (result);
+
+    if (result == EPERM || result == ENOMEM)
+        reason << T(" (check the rtprio and memlock limits)");
+#else
+    reason = T("not supported on this platform");
+#endif
+
+    return what + T(": no - ") + reason + T("\n");
+}
+
+const String RealtimeAudioSetup::getReport() const
+{
+    String s;
+
+    if (shouldLockMemory)
+    {
+        s << describeResult (T("memory locked"), memoryLockResult)
+          << describeResult (T("heap reserve prefaulted (") + String (heapReserveBytes / (1024 * 1024)) + T("MB)"),
+                             heapPrefaultResult);
+    }
+
+    if (cpuToPinTo >= 0)
+        s << describeResult (T("audio thread pinned to cpu ") + String (cpuToPinTo), affinityResult);
+
+    if (fifoPriority > 0)
+        s << describeResult (T("audio thread SCHED_FIFO priority ") + String (fifoPriority), priorityResult);
+
+    if (fifoPriority > 0 && numPipelineWorkers > 0)
+        s << describeResult (String (numPipelineWorkers) + T(" pipeline workers SCHED_FIFO priority ") + String (fifoPriority),
+                             workerPriorityResult);
+
+    if (numThreadsConfigured > 1)
+        s << String (numThreadsConfigured) << T(" audio threads have been set up\n");
+
+    return s;
+}
@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+#ifndef __JUCE_REALTIMEAUDIOSETUP_JUCEHEADER__
+#define __JUCE_REALTIMEAUDIOSETUP_JUCEHEADER__
+
+#include <juce.h>
+
+#if JUCE_LINUX
+ #include <pthread.h>
+#endif
+
+
+//==============================================================================
+/**
+    Hardens the audio path against page faults and preemption, as far as the
+    system will allow.
+
+    lockMemory() locks everything the process has mapped, and everything it maps
+    later, into ram, and prefaults a reserve of heap that the allocator is told
+    to keep, so that nothing the callback touches has to be paged in. The
+    streamer calls it each time the device starts, after the filter has
+    allocated its buffers.
+
+    applyToCurrentThread() is called at the start of every callback. The first
+    time it sees a new audio thread, it pins it to a cpu, gives it SCHED_FIFO
+    priority, and prefaults its stack; after that it's just a comparison.
+
+    A pipelined AudioProcessorChain calls applyToWorkerThread() from each of its
+    stage workers. The callback doesn't wait for them, but if they're preempted
+    the pipeline stalls, so they get the same SCHED_FIFO priority (and a prefaulted
+    stack) as the audio thread. They aren't pinned to its cpu, because the point of
+    the workers is to run alongside it.
+
+    Anything that fails (usually for lack of privileges) is left as it was, and
+    getReport() says what was and wasn't applied. This only does anything on Linux.
+
+    Options on the command line:
+        --mlock             lock and prefault memory
+        --cpu n             pin the audio thread to cpu n
+        --fifo [priority]   run the audio thread, and a pipelined chain's workers, as
+                            SCHED_FIFO (default priority 70)
+*/
+class RealtimeAudioSetup
+{
+public:
+    //==============================================================================
+    RealtimeAudioSetup();
+    ~RealtimeAudioSetup();
+
+    /** Creates a setup from the options on a command line, or returns 0 if it doesn't ask for any. */
+    static RealtimeAudioSetup* createFromCommandLine (const StringArray& args);
+
+    //==============================================================================
+    void setLockMemory (const bool shouldLock)              { shouldLockMemory = shouldLock; }
+
+    /** Sets the cpu to pin the audio thread to, or -1 to leave it alone. */
+    void setCpuToPinTo (const int cpuNumber)                { cpuToPinTo = cpuNumber; }
+
+    /** Sets the SCHED_FIFO priority for the audio thread, or 0 to leave it alone. */
+    void setFifoPriority (const int priority)               { fifoPriority = priority; }
+
+    //==============================================================================
+    /** Locks and prefaults memory, if that's been asked for. Call this on the message
+        thread once everything the callback will use has been allocated.
+    */
+    void lockMemory();
+
+    /** Called by the audio thread before each callback. */
+    void applyToCurrentThread() throw();
+
+    /** Called once by each of a pipelined chain's worker threads, when it first sees this
+        setup, with the number of workers that the chain has at the moment. (The chain makes
+        new ones each time it's restarted, so that's what the report counts.)
+    */
+    void applyToWorkerThread (const int numWorkersInPipeline) throw();
+
+    /** Returns a line for each thing that was asked for, saying whether it worked. */
+    const String getReport() const;
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    enum { notTried = -1 };
+
+    bool shouldLockMemory;
+    int cpuToPinTo, fifoPriority;
+
+    int memoryLockResult, heapPrefaultResult;
+    volatile int affinityResult, priorityResult, numThreadsConfigured;
+    volatile int workerPriorityResult, numPipelineWorkers;
+
+#if JUCE_LINUX
+    pthread_t configuredThread;
+#endif
+
+    RealtimeAudioSetup (const RealtimeAudioSetup&);
+    const RealtimeAudioSetup& operator= (const RealtimeAudioSetup&);
+};
+
+
+#endif   // __JUCE_REALTIMEAUDIOSETUP_JUCEHEADER__
@@ -0,0 +1,437 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#include "juce_SharedMemoryAudioIODevice.h"
+
+#if JUCE_LINUX
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <fcntl.h>
+ #include <errno.h>
+ #include <string.h>
+#endif
+
+
+//==============================================================================
+// the slots are indexed by the block counters modulo their number, which only
+// carries on smoothly when a counter wraps if the number's a power of two
+static int roundUpToPowerOfTwo (const int n)
+{
+    int powerOfTwo = 1;
+
+    while (powerOfTwo < n && powerOfTwo < (1 << 20))
+        powerOfTwo <<= 1;
+
+    return powerOfTwo;
+}
+
+SharedMemoryAudioIODevice::SharedMemoryAudioIODevice (const String& segmentName_,
+                                                      const int numInputChannels,
+                                                      const int numOutputChannels,
+                                                      const int numSlots_)
+    : AudioIODevice (T("Shared memory ") + segmentName_, T("Shared memory")),
+      Thread (T("Shared memory audio device")),
+      segmentName (segmentName_.startsWithChar (T('/')) ? segmentName_ : T("/") + segmentName_),
+      numInputs (jmax (0, numInputChannels)),
+      numOutputs (jmax (0, numOutputChannels)),
+      numSlots (roundUpToPowerOfTwo (jmax (2, numSlots_))),
+      segmentHandle (-1),
+      header (0),
+      segmentSize (0),
+      currentSampleRate (44100.0),
+      currentBufferSize (512),
+      callback (0),
+      inputPointers (0),
+      outputPointers (0),
+      numBlocksDone (0),
+      numOutputStalls (0)
+{
+}
+
+SharedMemoryAudioIODevice::~SharedMemoryAudioIODevice()
+{
+    close();
+}
+
+//==============================================================================
+bool SharedMemoryAudioIODevice::isClientAttached() const throw()
+{
+    return header != 0 && header->clientAttached != 0;
+}
+
+bool SharedMemoryAudioIODevice::waitForClientToFinish (const int timeOutMilliseconds)
+{
+    const uint32 startTime = Time::getMillisecondCounter();
+
+    while (header != 0)
+    {
+        // (a client that's been and gone between two polls still counts, by the blocks it left behind)
+        if (! isClientAttached() && numBlocksDone > 0)
+            return true;
+
+        if (timeOutMilliseconds >= 0
+             && Time::getMillisecondCounter() - startTime >= (uint32) timeOutMilliseconds)
+            return false;
+
+        Thread::sleep (20);
+    }
+
+    return false;
+}
+
+//==============================================================================
+const StringArray SharedMemoryAudioIODevice::getOutputChannelNames()
+{
+    StringArray names;
+
+    for (int i = 0; i < numOutputs; ++i)
+        names.add (T("Shared memory output ") + String (i + 1));
+
+    return names;
+}
+
+const StringArray SharedMemoryAudioIODevice::getInputChannelNames()
+{
+    StringArray names;
+
+    for (int i = 0; i < numInputs; ++i)
+        names.add (T("Shared memory input ") + String (i + 1));
+
+    return names;
+}
+
+static const double sharedMemorySampleRates[] = { 22050.0, 32000.0, 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+static const int sharedMemoryBufferSizes[] = { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+
+int SharedMemoryAudioIODevice::getNumSampleRates()
+{
+    return numElementsInArray (sharedMemorySampleRates);
+}
+
+double SharedMemoryAudioIODevice::getSampleRate (int index)
+{
+    return sharedMemorySampleRates [jlimit (0, getNumSampleRates() - 1, index)];
+}
+
+int SharedMemoryAudioIODevice::getNumBufferSizesAvailable()
+{
+    return numElementsInArray (sharedMemoryBufferSizes);
+}
+
+int SharedMemoryAudioIODevice::getBufferSizeSamples (int index)
+{
+    return sharedMemoryBufferSizes [jlimit (0, getNumBufferSizesAvailable() - 1, index)];
+}
+
+int SharedMemoryAudioIODevice::getDefaultBufferSize()
+{
+    return 256;
+}
+
+//==============================================================================
+const String SharedMemoryAudioIODevice::open (const BitArray& inputChannels,
+                                              const BitArray& outputChannels,
+                                              double sampleRate,
+                                              int bufferSizeSamples)
+{
+    close();
+    lastError = String::empty;
+
+    // (any rate and size will do, not just the ones in the lists)
+    if (sampleRate <= 0 || bufferSizeSamples <= 0)
+    {
+        lastError = T("The shared memory device needs a positive sample rate and buffer size");
+        return lastError;
+    }
+
+#if JUCE_LINUX
+    currentSampleRate = sampleRate;
+    currentBufferSize = bufferSizeSamples;
+
+    activeInputs.clear();
+    activeOutputs.clear();
+
+    int i;
+    for (i = 0; i < numInputs; ++i)
+        if (inputChannels [i])
+            activeInputs.setBit (i);
+
+    for (i = 0; i < numOutputs; ++i)
+        if (outputChannels [i])
+            activeOutputs.setBit (i);
+
+    SharedAudioHeader format;
+    zeromem (&format, sizeof (format));
+    format.version = sharedAudioVersion;
+    format.headerSize = sharedAudioHeaderSize;
+    format.sampleRate = (unsigned int) roundDoubleToInt (sampleRate);
+    format.blockSize = (unsigned int) bufferSizeSamples;
+    format.numInputChannels = (unsigned int) numInputs;
+    format.numOutputChannels = (unsigned int) numOutputs;
+    format.numSlots = (unsigned int) numSlots;
+
+    segmentSize = getSharedAudioSegmentSize (&format);
+
+    // (one left behind by a process that crashed would have the wrong format, or stale counters)
+    shm_unlink ((const char*) segmentName);
+
+    segmentHandle = shm_open ((const char*) segmentName, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if (segmentHandle < 0 || ftruncate (segmentHandle, segmentSize) != 0)
+    {
+        lastError = T("Couldn't create the shared memory segment ") + segmentName + T(": ") + strerror (errno);
+        close();
+        return lastError;
+    }
+
+    void* const memory = mmap (0, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, segmentHandle, 0);
+
+    if (memory == MAP_FAILED)
+    {
+        lastError = T("Couldn't map the shared memory segment ") + segmentName + T(": ") + strerror (errno);
+        close();
+        return lastError;
+    }
+
+    // The segment starts off zeroed, so the rings are silent and the counters are at 0.
+    // The magic number goes in last, so that a client that sees it sees everything else too.
+    header = (SharedAudioHeader*) memory;
+    memcpy (header, &format, sizeof (format));
+    sharedAudioMemoryBarrier();
+    header->magic = sharedAudioMagic;
+
+    inputPointers = (const float**) juce_calloc (sizeof (float*) * (numInputs + 1));
+    outputPointers = (float**) juce_calloc (sizeof (float*) * (numOutputs + 1));
+
+    return String::empty;
+#else
+    (void) inputChannels;
+    (void) outputChannels;
+    lastError = T("The shared memory device only works on Linux");
+    return lastError;
+#endif
+}
+
+void SharedMemoryAudioIODevice::close()
+{
+    stop();
+
+#if JUCE_LINUX
+    if (header != 0)
+    {
+        header->magic = 0;
+        munmap (header, segmentSize);
+        header = 0;
+    }
+
+    if (segmentHandle >= 0)
+    {
+        ::close (segmentHandle);
+        segmentHandle = -1;
+
+        // (a client that's still got it mapped keeps it until it lets go)
+        shm_unlink ((const char*) segmentName);
+    }
+#endif
+
+    juce_free (inputPointers);
+    inputPointers = 0;
+    juce_free (outputPointers);
+    outputPointers = 0;
+}
+
+bool SharedMemoryAudioIODevice::isOpen()
+{
+    return header != 0;
+}
+
+void SharedMemoryAudioIODevice::start (AudioIODeviceCallback* newCallback)
+{
+    if (header == 0 || newCallback == 0)
+        return;
+
+    stop();
+
+    newCallback->audioDeviceAboutToStart (this);
+
+    numBlocksDone = 0;
+    numOutputStalls = 0;
+
+    {
+        const ScopedLock sl (callbackLock);
+        callback = newCallback;
+    }
+
+    header->deviceRunning = 1;
+    startThread (9);
+}
+
+void SharedMemoryAudioIODevice::stop()
+{
+#if JUCE_LINUX
+    if (header != 0)
+    {
+        // (and wake a client that's waiting for the device, so it can see that it's gone)
+        header->deviceRunning = 0;
+        sharedAudioWake (&header->inputBlocksRead);
+        sharedAudioWake (&header->outputBlocksWritten);
+    }
+#endif
+
+    stopThread (5000);
+
+    AudioIODeviceCallback* lastCallback;
+
+    {
+        const ScopedLock sl (callbackLock);
+        lastCallback = callback;
+        callback = 0;
+    }
+
+    if (lastCallback != 0)
+        lastCallback->audioDeviceStopped();
+}
+
+bool SharedMemoryAudioIODevice::isPlaying()
+{
+    return callback != 0;
+}
+
+const String SharedMemoryAudioIODevice::getLastError()
+{
+    return lastError;
+}
+
+int SharedMemoryAudioIODevice::getCurrentBufferSizeSamples()
+{
+    return currentBufferSize;
+}
+
+double SharedMemoryAudioIODevice::getCurrentSampleRate()
+{
+    return currentSampleRate;
+}
+
+int SharedMemoryAudioIODevice::getCurrentBitDepth()
+{
+    return 32;
+}
+
+const BitArray SharedMemoryAudioIODevice::getActiveOutputChannels() const
+{
+    return activeOutputs;
+}
+
+const BitArray SharedMemoryAudioIODevice::getActiveInputChannels() const
+{
+    return activeInputs;
+}
+
+int SharedMemoryAudioIODevice::getOutputLatencyInSamples()
+{
+    // (the output's handed back in the same period that the input arrived)
+    return 0;
+}
+
+int SharedMemoryAudioIODevice::getInputLatencyInSamples()
+{
+    // (the block that the client collects before it sends it)
+    return currentBufferSize;
+}
+
+//==============================================================================
+void SharedMemoryAudioIODevice::run()
+{
+#if JUCE_LINUX
+    SharedAudioHeader* const h = header;
+    bool stalled = false;
+
+    while (! threadShouldExit())
+    {
+        // (the timeouts on the waits are only there so that the thread can be stopped)
+        const unsigned int blockNumber = h->inputBlocksRead;
+        const unsigned int numWritten = h->inputBlocksWritten;
+
+        if (numWritten == blockNumber)
+        {
+            sharedAudioWait (&h->inputBlocksWritten, numWritten, 50);
+            continue;
+        }
+
+        const unsigned int outputBlock = h->outputBlocksWritten;
+        const unsigned int numOutputsRead = h->outputBlocksRead;
+
+        if (outputBlock - numOutputsRead >= h->numSlots)
+        {
+            if (! stalled)
+            {
+                stalled = true;
+                ++numOutputStalls;
+            }
+
+            sharedAudioWait (&h->outputBlocksRead, numOutputsRead, 50);
+            continue;
+        }
+
+        stalled = false;
+
+        // (the client's writes to the slot happened before it moved the counter)
+        sharedAudioMemoryBarrier();
+
+        int i;
+        for (i = 0; i < numInputs; ++i)
+            inputPointers[i] = activeInputs [i] ? getSharedAudioInput (h, blockNumber, i) : 0;
+
+        for (i = 0; i < numOutputs; ++i)
+            outputPointers[i] = activeOutputs [i] ? getSharedAudioOutput (h, outputBlock, i) : 0;
+
+        {
+            const ScopedLock sl (callbackLock);
+
+            if (callback != 0)
+                callback->audioDeviceIOCallback (inputPointers, numInputs,
+                                                 outputPointers, numOutputs,
+                                                 currentBufferSize);
+        }
+
+        sharedAudioMemoryBarrier();
+
+        h->inputBlocksRead = blockNumber + 1;
+        h->outputBlocksWritten = outputBlock + 1;
+
+        sharedAudioWake (&h->inputBlocksRead);
+        sharedAudioWake (&h->outputBlocksWritten);
+
+        ++numBlocksDone;
+    }
+#endif
+}
@@ -0,0 +1,150 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#ifndef __JUCE_SHAREDMEMORYAUDIOIODEVICE_JUCEHEADER__
+#define __JUCE_SHAREDMEMORYAUDIOIODEVICE_JUCEHEADER__
+
+#include <juce.h>
+#include "juce_SharedMemoryAudioProtocol.h"
+
+
+//==============================================================================
+/**
+    An AudioIODevice whose audio comes from, and goes back to, another process
+    through a POSIX shared memory segment.
+
+    Opening the device creates the segment (e.g. "/kitty") in the format it's
+    opened with, and a client then attaches to it and feeds it blocks, as
+    described in juce_SharedMemoryAudioProtocol.h. The device's thread sleeps
+    until a block arrives, calls the callback with pointers straight into the
+    segment, and wakes the client up again, so nothing's copied on the way in
+    or out. The client sets the pace, so the device has no clock of its own.
+
+    tools/kittyShmClient.cpp is a client that can be used to drive it.
+
+    This only works on Linux, and open() fails anywhere else.
+*/
+class SharedMemoryAudioIODevice  : public AudioIODevice,
+                                   private Thread
+{
+public:
+    //==============================================================================
+    /** Creates a device that will serve a segment with the given name.
+        numSlots is the number of blocks each ring can hold, which is rounded up
+        to a power of two (see juce_SharedMemoryAudioProtocol.h).
+    */
+    SharedMemoryAudioIODevice (const String& segmentName,
+                               const int numInputChannels,
+                               const int numOutputChannels,
+                               const int numSlots = 4);
+
+    ~SharedMemoryAudioIODevice();
+
+    //==============================================================================
+    /** Returns true if a client's attached to the segment at the moment. */
+    bool isClientAttached() const throw();
+
+    /** Waits until a client has attached and then detached again, or until the
+        timeout expires. Returns true if the client's finished.
+    */
+    bool waitForClientToFinish (const int timeOutMilliseconds = -1);
+
+    /** The number of blocks done since the device was last started. */
+    int64 getNumBlocksDone() const throw()                  { return numBlocksDone; }
+
+    /** The number of times the device had a block to do but had to wait, because
+        the client hadn't read the output ring and it was full.
+    */
+    int getNumOutputStalls() const throw()                  { return numOutputStalls; }
+
+    //==============================================================================
+    const StringArray getOutputChannelNames();
+    const StringArray getInputChannelNames();
+    int getNumSampleRates();
+    double getSampleRate (int index);
+    int getNumBufferSizesAvailable();
+    int getBufferSizeSamples (int index);
+    int getDefaultBufferSize();
+
+    const String open (const BitArray& inputChannels,
+                       const BitArray& outputChannels,
+                       double sampleRate,
+                       int bufferSizeSamples);
+    void close();
+    bool isOpen();
+
+    void start (AudioIODeviceCallback* callback);
+    void stop();
+    bool isPlaying();
+
+    const String getLastError();
+    int getCurrentBufferSizeSamples();
+    double getCurrentSampleRate();
+    int getCurrentBitDepth();
+    const BitArray getActiveOutputChannels() const;
+    const BitArray getActiveInputChannels() const;
+    int getOutputLatencyInSamples();
+    int getInputLatencyInSamples();
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    const String segmentName;
+    const int numInputs, numOutputs, numSlots;
+
+    int segmentHandle;
+    SharedAudioHeader* header;
+    unsigned int segmentSize;
+
+    double currentSampleRate;
+    int currentBufferSize;
+    BitArray activeInputs, activeOutputs;
+    String lastError;
+
+    CriticalSection callbackLock;
+    AudioIODeviceCallback* callback;
+
+    const float** inputPointers;
+    float** outputPointers;
+
+    volatile int64 numBlocksDone;
+    volatile int numOutputStalls;
+
+    void run();
+
+    SharedMemoryAudioIODevice (const SharedMemoryAudioIODevice&);
+    const SharedMemoryAudioIODevice& operator= (const SharedMemoryAudioIODevice&);
+};
+
+
+#endif   // __JUCE_SHAREDMEMORYAUDIOIODEVICE_JUCEHEADER__
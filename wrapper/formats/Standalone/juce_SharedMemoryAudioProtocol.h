@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+   This file is part of the JUCE library - "Jules' Utility Class Extensions"
+   Copyright 2004-7 by Raw Material Software ltd.
+
+  ------------------------------------------------------------------------------
+
+   JUCE can be redistributed and/or modified under the terms of the
+   GNU General Public License, as published by the Free Software Foundation;
+   either version 2 of the License, or (at your option) any later version.
+
+   JUCE is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with JUCE; if not, visit www.gnu.org/licenses or write to the
+   Free Software Foundation, Inc., 59 Temple Place, Suite 330,
+   Boston, MA 02111-1307 USA
+
+  ------------------------------------------------------------------------------
+
+   If you'd like to release a closed-source product which uses JUCE, commercial
+   licenses are also available: visit www.rawmaterialsoftware.com/juce for
+   more information.
+
+  ==============================================================================
+*/
+
+
+#ifndef __JUCE_SHAREDMEMORYAUDIOPROTOCOL_JUCEHEADER__
+#define __JUCE_SHAREDMEMORYAUDIOPROTOCOL_JUCEHEADER__
+
+/*
+    The layout of the shared memory segment that SharedMemoryAudioIODevice
+    serves, and the protocol for using it.
+
+    This doesn't use juce, so that a client can include it on its own.
+
+    The segment is a SharedAudioHeader followed by two rings of blocks: the
+    client writes the input ring, and the device reads it and writes the
+    output ring, which the client reads. Each slot in a ring holds one block
+    of non-interleaved float channels, one after another, and the callback is
+    given pointers straight into them.
+
+    Each side only ever writes its own two counters, which count blocks since
+    the device was opened and are allowed to wrap. Block n lives in slot
+    n % numSlots, and numSlots is always a power of two, so that the slot
+    carries on to the next one when a counter wraps to 0. To send a block,
+    the client waits until inputBlocksWritten - inputBlocksRead < numSlots,
+    fills the slot, bumps inputBlocksWritten and wakes anyone waiting on it.
+    When the device has processed that block, it bumps inputBlocksRead and
+    outputBlocksWritten, and the client reads the output slot and bumps
+    outputBlocksRead. A client that waits for each block's output before
+    sending the next one gets it back within the same period, so the round
+    trip adds a single block of latency on the client's side.
+
+    The device blocks when the client falls behind reading the output ring,
+    so the client is always the clock. Waits are done with futexes on the
+    counters themselves, so a side that's waiting is woken as soon as the
+    counter it's waiting on moves, and nobody spins.
+*/
+
+#ifdef __linux__
+ #include <unistd.h>
+ #include <time.h>
+ #include <sys/syscall.h>
+ #include <linux/futex.h>
+#endif
+
+//==============================================================================
+enum
+{
+    sharedAudioMagic        = 0x6b747479,   // "ktty"
+    sharedAudioVersion      = 1,
+    sharedAudioHeaderSize   = 256
+};
+
+struct SharedAudioHeader
+{
+    // filled in by the device before anything else, and fixed after that
+    unsigned int magic, version, headerSize;
+    unsigned int sampleRate, blockSize, numInputChannels, numOutputChannels, numSlots;
+
+    // set while the device is taking blocks, and cleared when it closes
+    volatile unsigned int deviceRunning;
+    char pad1 [64 - 9 * sizeof (unsigned int)];
+
+    // written only by the client (each side's counters get a cache line of their own)
+    volatile unsigned int inputBlocksWritten, outputBlocksRead;
+    volatile unsigned int clientAttached;
+    char pad2 [64 - 3 * sizeof (unsigned int)];
+
+    // written only by the device
+    volatile unsigned int inputBlocksRead, outputBlocksWritten;
+    char pad3 [64 - 2 * sizeof (unsigned int)];
+};
+
+//==============================================================================
+/** The number of bytes the segment needs, for a header that's been filled in. */
+static inline unsigned int getSharedAudioSegmentSize (const SharedAudioHeader* h)
+{
+    return h->headerSize + sizeof (float) * h->blockSize * h->numSlots
+                                          * (h->numInputChannels + h->numOutputChannels);
+}
+
+/** Returns a channel of the input slot that holds a given block. */
+static inline float* getSharedAudioInput (SharedAudioHeader* h, const unsigned int blockNumber, const unsigned int channel)
+{
+    float* const ring = (float*) (((char*) h) + h->headerSize);
+
+    return ring + ((blockNumber % h->numSlots) * h->numInputChannels + channel) * h->blockSize;
+}
+
+/** Returns a channel of the output slot that holds a given block. */
+static inline float* getSharedAudioOutput (SharedAudioHeader* h, const unsigned int blockNumber, const unsigned int channel)
+{
+    float* const ring = (float*) (((char*) h) + h->headerSize)
+                          + h->numSlots * h->numInputChannels * h->blockSize;
+
+    return ring + ((blockNumber % h->numSlots) * h->numOutputChannels + channel) * h->blockSize;
+}
+
+//==============================================================================
+#ifdef __linux__
+/** Makes sure everything written to a slot is visible before the counter that publishes it,
+    and that a counter's been read before the slot it refers to.
+*/
+static inline void sharedAudioMemoryBarrier()
+{
+    __sync_synchronize();
+}
+
+/** Sleeps until another process changes a counter from the value given, or the timeout
+    expires. It returns straight away if the counter's already changed.
+*/
+static inline void sharedAudioWait (volatile unsigned int* counter, const unsigned int valueSeen, const int timeOutMs)
+{
+    struct timespec timeout;
+    timeout.tv_sec = timeOutMs / 1000;
+    timeout.tv_nsec = (timeOutMs % 1000) * 1000000;
+
+    // (not FUTEX_WAIT_PRIVATE, as the other side is in another process)
+    syscall (SYS_futex, (unsigned int*) counter, FUTEX_WAIT, valueSeen, &timeout, 0, 0);
+}
+
+/** Wakes anything that's waiting on a counter. */
+static inline void sharedAudioWake (volatile unsigned int* counter)
+{
+    syscall (SYS_futex, (unsigned int*) counter, FUTEX_WAKE, 0x7fffffff, 0, 0, 0);
+}
+#endif
+
+
+#endif   // __JUCE_SHAREDMEMORYAUDIOPROTOCOL_JUCEHEADER__
@@ -30,24 +30,23 @@
 */
 
 #include "juce_StandaloneFilterWindow.h"
+#include "juce_HeadlessStreamer.h"
 #include "../../juce_IncludeCharacteristics.h"
 
-//==============================================================================
-/** Somewhere in the codebase of your plugin, you need to implement this function
-    and make it create an instance of the filter subclass that you're building.
-*/
-extern AudioProcessor* JUCE_CALLTYPE createPluginFilter();
-
-
 //==============================================================================
 StandaloneFilterWindow::StandaloneFilterWindow (const String& title,
-                                                const Colour& backgroundColour)
+                                                const Colour& backgroundColour,
+                                                const int numChainStages_,
+                                                const bool pipelineChain_)
     : DocumentWindow (title, backgroundColour,
                       DocumentWindow::minimiseButton
                        | DocumentWindow::closeButton),
       filter (0),
+      numChainStages (jmax (1, numChainStages_)),
+      pipelineChain (pipelineChain_),
       deviceManager (0),
-      optionsButton (0)
+      optionsButton (0),
+      realtimeSetup (0)
 {
     setTitleBarButtonsRequired (DocumentWindow::minimiseButton | DocumentWindow::closeButton, false);
 
@@ -60,7 +59,7 @@ StandaloneFilterWindow::StandaloneFilterWindow (const String& title,
 
     JUCE_TRY
     {
-        filter = createPluginFilter();
+        filter = AudioProcessorChain::createForPlugin (numChainStages, pipelineChain);
 
         if (filter != 0)
         {
@@ -92,6 +91,11 @@ StandaloneFilterWindow::StandaloneFilterWindow (const String& title,
 
             setContentComponent (filter->createEditorIfNeeded(), true, true);
 
+            const AudioProcessorChain* const chain = dynamic_cast <const AudioProcessorChain*> (filter);
+
+            if (chain != 0)
+                setName (title + T(" - ") + chain->getDescription());
+
             const int x = globalSettings->getIntValue (T("windowX"), -100);
             const int y = globalSettings->getIntValue (T("windowY"), -100);
 
@@ -140,6 +144,20 @@ StandaloneFilterWindow::~StandaloneFilterWindow()
 }
 
 //==============================================================================
+void StandaloneFilterWindow::setRealtimeSetup (RealtimeAudioSetup* newSetup)
+{
+    realtimeSetup = newSetup;
+
+    if (deviceManager != 0)
+        deviceManager->setRealtimeSetup (newSetup);
+}
+
+void StandaloneFilterWindow::setMetricsFile (const File& file, const double intervalSeconds)
+{
+    if (deviceManager != 0)
+        deviceManager->setMetricsFile (file, intervalSeconds);
+}
+
 void StandaloneFilterWindow::deleteFilter()
 {
     if (deviceManager != 0)
@@ -158,7 +176,7 @@ void StandaloneFilterWindow::resetFilter()
 {
     deleteFilter();
 
-    filter = createPluginFilter();
+    filter = AudioProcessorChain::createForPlugin (numChainStages, pipelineChain);
 
     if (filter != 0)
     {
@@ -222,6 +240,113 @@ void StandaloneFilterWindow::loadState()
     }
 }
 
+void StandaloneFilterWindow::toggleRecording()
+{
+    AudioFilterStreamer* const streamer = deviceManager != 0 ? deviceManager->getStreamer() : 0;
+
+    if (streamer == 0)
+        return;
+
+    const AudioStreamRecorder& recorder = streamer->getRecorder();
+
+    if (recorder.isRecording())
+    {
+        streamer->stopRecording();
+
+        if (recorder.getNumSamplesDropped() > 0)
+        {
+            AlertWindow::showMessageBox (AlertWindow::WarningIcon,
+                                         TRANS("Recording"),
+                                         TRANS("The disk couldn't keep up, so some of the recording is missing.")
+                                           + T("\n\n") + String ((int) recorder.getNumSamplesDropped())
+                                           + T(" samples were dropped."));
+        }
+
+        return;
+    }
+
+    PropertySet* const globalSettings = getGlobalSettings();
+
+    FileChooser fc (TRANS("Record the output to a file"),
+                    globalSettings != 0 ? File (globalSettings->getValue (T("lastRecordingFile")))
+                                        : File::nonexistent,
+                    T("*.wav"));
+
+    if (fc.browseForFileToSave (true))
+    {
+        const String error (streamer->startRecording (fc.getResult().withFileExtension (T("wav"))));
+
+        if (error.isNotEmpty())
+        {
+            AlertWindow::showMessageBox (AlertWindow::WarningIcon,
+                                         TRANS("Couldn't start recording"),
+                                         error);
+        }
+        else if (globalSettings != 0)
+        {
+            globalSettings->setValue (T("lastRecordingFile"), fc.getResult().getFullPathName());
+        }
+    }
+}
+
+void StandaloneFilterWindow::toggleFileInput()
+{
+    AudioFilterStreamer* const streamer = deviceManager != 0 ? deviceManager->getStreamer() : 0;
+
+    if (streamer == 0)
+        return;
+
+    const AudioFileInputSource& fileInput = streamer->getFileInput();
+
+    if (fileInput.isPlaying())
+    {
+        const int numUnderruns = fileInput.getNumUnderruns();
+        streamer->stopFileInput();
+
+        if (numUnderruns > 0)
+        {
+            AlertWindow::showMessageBox (AlertWindow::WarningIcon,
+                                         TRANS("File input"),
+                                         TRANS("The file couldn't be read fast enough, so parts of it were replaced by silence.")
+                                           + T("\n\n") + String (numUnderruns) + T(" blocks were affected."));
+        }
+
+        return;
+    }
+
+    PropertySet* const globalSettings = getGlobalSettings();
+
+    FileChooser fc (TRANS("Choose a file to use as the input"),
+                    globalSettings != 0 ? File (globalSettings->getValue (T("lastInputFile")))
+                                        : File::nonexistent,
+                    T("*.wav"));
+
+    if (fc.browseForFileToOpen())
+    {
+        const String error (streamer->startFileInput (fc.getResult(), true));
+
+        if (error.isNotEmpty())
+        {
+            AlertWindow::showMessageBox (AlertWindow::WarningIcon,
+                                         TRANS("Couldn't play the file"),
+                                         error);
+            return;
+        }
+
+        if (globalSettings != 0)
+            globalSettings->setValue (T("lastInputFile"), fc.getResult().getFullPathName());
+
+        AudioIODevice* const device = deviceManager->getCurrentAudioDevice();
+
+        if (device != 0 && fabs (device->getCurrentSampleRate() - fileInput.getFileSampleRate()) > 0.5)
+        {
+            AlertWindow::showMessageBox (AlertWindow::InfoIcon,
+                                         TRANS("File input"),
+                                         TRANS("The file's sample rate doesn't match the device's, so it'll play at the wrong speed."));
+        }
+    }
+}
+
 //==============================================================================
 PropertySet* StandaloneFilterWindow::getGlobalSettings()
 {
@@ -276,6 +401,46 @@ void StandaloneFilterWindow::buttonClicked (Button*)
     m.addItem (3, TRANS("Load a saved state..."));
     m.addSeparator();
     m.addItem (4, TRANS("Reset to default state"));
+    m.addSeparator();
+
+    const AudioFilterStreamer* const streamer = deviceManager != 0 ? deviceManager->getStreamer() : 0;
+
+    if (streamer != 0 && streamer->getRecorder().isRecording())
+        m.addItem (5, TRANS("Stop recording"));
+    else
+        m.addItem (5, TRANS("Record output..."), streamer != 0);
+
+    if (streamer != 0 && streamer->getFileInput().isPlaying())
+        m.addItem (6, TRANS("Stop playing file"));
+    else
+        m.addItem (6, TRANS("Loop a file as input..."), streamer != 0);
+
+    const AudioProcessorChain* const chain = dynamic_cast <const AudioProcessorChain*> (filter);
+
+    if (chain != 0)
+    {
+        m.addSeparator();
+        m.addItem (7, TRANS("Chain: ") + chain->getDescription(), false);
+
+        if (chain->getNumPipelineStalls() > 0)
+            m.addItem (8, String (chain->getNumPipelineStalls()) + TRANS(" blocks lost to pipeline stalls"), false);
+    }
+
+    if (realtimeSetup != 0)
+    {
+        // (the thread settings are only tried once the audio thread has run a callback)
+        StringArray lines;
+        lines.addLines (realtimeSetup->getReport());
+        lines.removeEmptyStrings();
+
+        PopupMenu report;
+
+        for (int i = 0; i < lines.size(); ++i)
+            report.addItem (100 + i, lines[i], false);
+
+        m.addSeparator();
+        m.addSubMenu (TRANS("Real-time setup"), report);
+    }
 
     switch (m.showAt (optionsButton))
     {
@@ -295,6 +460,14 @@ void StandaloneFilterWindow::buttonClicked (Button*)
         resetFilter();
         break;
 
+    case 5:
+        toggleRecording();
+        break;
+
+    case 6:
+        toggleFileInput();
+        break;
+
     default:
         break;
     }
@@ -303,11 +476,13 @@ void StandaloneFilterWindow::buttonClicked (Button*)
 class app : public JUCEApplication
 {
     StandaloneFilterWindow *wnd;
+    RealtimeAudioSetup *realtimeSetup;
 	
 	public:
 	    app()
 	    {
 			wnd = 0;
+			realtimeSetup = 0;
 		}
 		~app()
 		{
@@ -315,15 +490,46 @@ class app : public JUCEApplication
 	    void initialise (const String& commandLine)
 	    {
 			ApplicationProperties::getInstance()->setStorageParameters(T("kitty"),T(".options"),T("settings"),250,PropertiesFile::storeAsXML);
-			wnd = new StandaloneFilterWindow(T("kitty"), Colours::white);
 
-			wnd->centreWithSize (256, 128+28);
+			StringArray args;
+			args.addTokens (commandLine, true);
+
+			// "--chain n" runs n instances one after another, and "--pipeline" gives each its own thread
+			const int chainIndex = args.indexOf (T("--chain"));
+			const int numStages = (chainIndex >= 0) ? args [chainIndex + 1].getIntValue() : 1;
+
+			wnd = new StandaloneFilterWindow(T("kitty"), Colours::white, numStages, args.contains (T("--pipeline")));
+
+			realtimeSetup = RealtimeAudioSetup::createFromCommandLine (args);
+
+			if (realtimeSetup != 0)
+				wnd->setRealtimeSetup (realtimeSetup);
+
+			const int metricsIndex = args.indexOf (T("--metrics"));
+
+			if (metricsIndex >= 0 && metricsIndex < args.size() - 1)
+			{
+				const int intervalIndex = args.indexOf (T("--metrics-interval"));
+
+				wnd->setMetricsFile (File (args [metricsIndex + 1].unquoted()),
+				                     intervalIndex >= 0 ? args [intervalIndex + 1].getDoubleValue() : 10.0);
+			}
+
+			// (a chain's editor is taller than the filter's own, by its tab bar)
+			Component* const content = wnd->getContentComponent();
+
+			if (content != 0)
+				wnd->centreWithSize (content->getWidth(), content->getHeight()+28);
+			else
+				wnd->centreWithSize (256, 192+28);
 			wnd->setVisible (true);
 		}
 		void shutdown()
 		{
 		    if (wnd != 0)
 				delete wnd;
+
+			delete realtimeSetup;
 		}
 		const String getApplicationName()
 		{
@@ -342,4 +548,21 @@ class app : public JUCEApplication
 		}
 };
 
+#if JUCE_WIN32
 START_JUCE_APPLICATION (app)
+#else
+int main (int argc, char* argv[])
+{
+    StringArray args;
+
+    for (int i = 1; i < argc; ++i)
+        args.add (argv[i]);
+
+    // the headless modes are dispatched before the application object exists,
+    // so that none of the gui gets started and no display is needed
+    if (isHeadlessCommandLine (args))
+        return runHeadlessStreamer (args);
+
+    return JUCEApplication::main (argc, argv, new app());
+}
+#endif
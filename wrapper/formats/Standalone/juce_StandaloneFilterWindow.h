@@ -33,6 +33,7 @@
 #define __JUCE_STANDALONEFILTERWINDOW_JUCEHEADER__
 
 #include "juce_AudioFilterStreamer.h"
+#include "juce_AudioProcessorChain.h"
 
 
 //==============================================================================
@@ -42,6 +43,9 @@
     Just create one of these objects in your JUCEApplication::initialise() method, and
     let it do its work. It will create your filter object using the same createFilter() function
     that the other plugin wrappers use.
+
+    If it's asked for more than one stage, or for a pipelined chain, it runs an
+    AudioProcessorChain of that many instances of the filter instead.
 */
 class StandaloneFilterWindow    : public DocumentWindow,
                                   public ButtonListener
@@ -49,7 +53,9 @@ class StandaloneFilterWindow    : public DocumentWindow,
 public:
     //==============================================================================
     StandaloneFilterWindow (const String& title,
-                            const Colour& backgroundColour);
+                            const Colour& backgroundColour,
+                            const int numChainStages = 1,
+                            const bool pipelineChain = false);
 
     ~StandaloneFilterWindow();
 
@@ -63,6 +69,26 @@ public:
     /** Pops up a dialog letting the user re-load the filter's state from a file. */
     void loadState();
 
+    /** Starts recording the filter's output to a file that the user picks, or
+        stops the recording that's running.
+    */
+    void toggleRecording();
+
+    /** Starts looping a file that the user picks into the filter in place of the
+        device's inputs, or goes back to the device's inputs.
+    */
+    void toggleFileInput();
+
+    /** Gives the audio thread a RealtimeAudioSetup to apply, and adds its report
+        to the options menu. The window doesn't delete it, so it must outlive the window.
+    */
+    void setRealtimeSetup (RealtimeAudioSetup* newSetup);
+
+    /** Keeps a file of the audio callback counters and timings up to date, for
+        a monitoring system to pick up. See AudioMetricsExporter for the format.
+    */
+    void setMetricsFile (const File& file, const double intervalSeconds);
+
     /** Shows the audio properties dialog box modally. */
     virtual void showAudioSettingsDialog();
 
@@ -84,8 +110,11 @@ public:
 
 private:
     AudioProcessor* filter;
+    const int numChainStages;
+    const bool pipelineChain;
     AudioFilterStreamingDeviceManager* deviceManager;
     Button* optionsButton;
+    RealtimeAudioSetup* realtimeSetup;
 
     void deleteFilter();
 
@@ -127,8 +127,14 @@
 
 #undef MemoryBlock
 
+#include "../../juce_ProcessTimingHistogram.h"
+#include "../../juce_LockFreeFifo.h"
+#include "../../juce_ProcessingGate.h"
+#include "../../juce_StartupTimings.h"
+
 class JuceVSTWrapper;
 static bool recursionCheck = false;
+static bool isGuiInitialised = false;
 static uint32 lastMasterIdleCall = 0;
 
 BEGIN_JUCE_NAMESPACE
@@ -329,13 +335,178 @@ public:
 
 static VoidArray activePlugins;
 
+//==============================================================================
+/*  One timer shared by all the plugin instances, which pokes the host while
+    the mouse is held down (some hosts stop sending idle calls during a drag).
+
+    It only runs while at least one editor is open, so a session full of
+    closed instances doesn't cause any wake-ups at all.
+*/
+class SharedIdleTimer  : public Timer
+{
+public:
+    SharedIdleTimer()
+        : numOpenEditors (0)
+    {
+    }
+
+    ~SharedIdleTimer()
+    {
+        stopTimer();
+        clearSingletonInstance();
+    }
+
+    void editorOpened()
+    {
+        if (++numOpenEditors == 1)
+            startTimer (1000 / 4);
+    }
+
+    void editorClosed()
+    {
+        jassert (numOpenEditors > 0);
+
+        if (--numOpenEditors <= 0)
+        {
+            numOpenEditors = 0;
+            stopTimer();
+        }
+    }
+
+    void timerCallback();
+
+    juce_DeclareSingleton (SharedIdleTimer, false)
+
+private:
+    int numOpenEditors;
+};
+
+juce_ImplementSingleton (SharedIdleTimer);
+
+//==============================================================================
+/*  Instances start up with only the non-gui parts of juce running, and this
+    brings up the rest the first time an editor is actually wanted. Hosts that
+    never open an editor (e.g. render nodes) never pay for it.
+
+    Returns true if it had to do the initialisation.
+*/
+static bool initialiseGuiIfNeeded()
+{
+    if (isGuiInitialised)
+        return false;
+
+    isGuiInitialised = true;
+    initialiseJuce_GUI();
+
+#if JUCE_LINUX
+    SharedMessageThread::getInstance();
+#endif
+
+    MessageManager::getInstance()->setTimeBeforeShowingWaitCursor (0);
+    return true;
+}
+
+#if JucePlugin_WantsMidiInput
+//==============================================================================
+/**
+    A fixed-size queue of short midi events, which processEvents() fills and
+    the process callback empties.
+
+    The space is all allocated by setCapacity(), so adding an event never
+    allocates - if the queue is full, the event is dropped and counted.
+*/
+class MidiEventRing
+{
+public:
+    MidiEventRing()
+        : events (0),
+          numDropped (0)
+    {
+    }
+
+    ~MidiEventRing()
+    {
+        juce_free (events);
+    }
+
+    /** Reallocates the queue and empties it. Don't call this while processing. */
+    void setCapacity (const int maxNumEvents)
+    {
+        juce_free (events);
+        events = (Event*) juce_calloc (sizeof (Event) * (maxNumEvents + 1));
+        fifo.setTotalSize (maxNumEvents + 1);
+        numDropped = 0;
+    }
+
+    /** Empties the queue. Don't call this while processing. */
+    void clear() throw()
+    {
+        fifo.reset();
+    }
+
+    void add (const uint8* const data, const int numBytes, const int samplePosition) throw()
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+        if (size1 == 0 || events == 0)
+        {
+            ++numDropped;
+            return;
+        }
+
+        Event& e = events [start1];
+        e.samplePosition = samplePosition;
+        e.numBytes = jlimit (0, 4, numBytes);
+        memcpy (e.data, data, e.numBytes);
+
+        fifo.finishedWrite (1);
+    }
+
+    /** Moves all the waiting events into a MidiBuffer. */
+    void removeAllInto (MidiBuffer& dest) throw()
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (fifo.getTotalSize(), start1, size1, start2, size2);
+
+        int i;
+        for (i = 0; i < size1; ++i)
+            dest.addEvent (events [start1 + i].data, events [start1 + i].numBytes, events [start1 + i].samplePosition);
+
+        for (i = 0; i < size2; ++i)
+            dest.addEvent (events [start2 + i].data, events [start2 + i].numBytes, events [start2 + i].samplePosition);
+
+        fifo.finishedRead (size1 + size2);
+    }
+
+    /** Returns the number of events that were thrown away because the queue was full. */
+    int getNumDropped() const throw()           { return numDropped; }
+
+    juce_UseDebuggingNewOperator
+
+private:
+    struct Event
+    {
+        int samplePosition;
+        int numBytes;
+        uint8 data [4];
+    };
+
+    Event* events;
+    LockFreeFifo fifo;
+    volatile int numDropped;
+
+    MidiEventRing (const MidiEventRing&);
+    const MidiEventRing& operator= (const MidiEventRing&);
+};
+#endif
+
 
 //==============================================================================
 /**
     This wraps an AudioProcessor as an AudioEffectX...
 */
 class JuceVSTWrapper  : public AudioEffectX,
-                        private Timer,
                         public AudioProcessorListener,
                         public AudioPlayHead
 {
@@ -349,9 +520,11 @@ public:
          filter (filter_)
     {
         editorComp = 0;
+#if JucePlugin_ProducesMidiOutput
         outgoingEvents = 0;
         outgoingEventSize = 0;
-        chunkMemoryTime = 0;
+        numOutgoingEventsDropped = 0;
+#endif
         isProcessing = false;
         firstResize = true;
         hasShutdown = false;
@@ -366,6 +539,14 @@ public:
 
         filter->setPlayConfigDetails (numInChans, numOutChans, 0, 0);
 
+        /*  The midi plumbing in this wrapper is compiled in or out according to the
+            JucePlugin_WantsMidiInput and JucePlugin_ProducesMidiOutput macros, so if
+            either of these assertions fails, your JucePluginCharacteristics.h file
+            disagrees with your filter's acceptsMidi() or producesMidi() methods.
+        */
+        jassert (filter->acceptsMidi() == ((JucePlugin_WantsMidiInput) != 0));
+        jassert (filter->producesMidi() == ((JucePlugin_ProducesMidiOutput) != 0));
+
         filter_->setPlayHead (this);
         filter_->addListener (this);
 
@@ -398,7 +579,6 @@ public:
 
     ~JuceVSTWrapper()
     {
-        stopTimer();
         deleteEditor();
 
         hasShutdown = true;
@@ -406,6 +586,7 @@ public:
         delete filter;
         filter = 0;
 
+#if JucePlugin_ProducesMidiOutput
         if (outgoingEvents != 0)
         {
             for (int i = outgoingEventSize; --i >= 0;)
@@ -414,6 +595,7 @@ public:
             juce_free (outgoingEvents);
             outgoingEvents = 0;
         }
+#endif
 
         jassert (editorComp == 0);
 
@@ -426,24 +608,34 @@ public:
 
         if (activePlugins.size() == 0)
         {
+            if (isGuiInitialised)
+            {
+                SharedIdleTimer::deleteInstance();
+
 #if JUCE_LINUX
-            SharedMessageThread::deleteInstance();
+                SharedMessageThread::deleteInstance();
 #endif
-            shutdownJuce_GUI();
+                shutdownJuce_GUI();
+                isGuiInitialised = false;
+            }
+            else
+            {
+                shutdownJuce_NonGUI();
+            }
         }
     }
 
     void open()
     {
-        startTimer (1000 / 4);
+        startupTimings.mark (PluginStartupTimings::opened);
     }
 
     void close()
     {
         jassert (! recursionCheck);
 
-        stopTimer();
         deleteEditor();
+        chunkMemory.setSize (0);
     }
 
     //==============================================================================
@@ -564,9 +756,9 @@ public:
             {
                 const VstMidiEvent* const vme = (const VstMidiEvent*) e;
 
-                midiEvents.addEvent ((const uint8*) vme->midiData,
-                                     4,
-                                     vme->deltaFrames);
+                incomingEvents.add ((const uint8*) vme->midiData,
+                                    4,
+                                    vme->deltaFrames);
             }
         }
 
@@ -578,6 +770,8 @@ public:
 
     void process (float** inputs, float** outputs, VstInt32 numSamples)
     {
+        const int64 startTime = ProcessTimingHistogram::getStartTime();
+
         const int numIn = numInChans;
         const int numOut = numOutChans;
 
@@ -586,15 +780,26 @@ public:
         for (i = numIn; --i >= 0;)
             memcpy (temp.getSampleData (i), outputs[i], sizeof (float) * numSamples);
 
-        processReplacing (inputs, outputs, numSamples);
+        processBlockReplacing (inputs, outputs, numSamples);
 
         AudioSampleBuffer dest (outputs, numOut, numSamples);
 
         for (i = jmin (numIn, numOut); --i >= 0;)
             dest.addFrom (i, 0, temp, i, 0, numSamples);
+
+        timingHistogram.addCallback (startTime, numSamples);
     }
 
     void processReplacing (float** inputs, float** outputs, VstInt32 numSamples)
+    {
+        const int64 startTime = ProcessTimingHistogram::getStartTime();
+
+        processBlockReplacing (inputs, outputs, numSamples);
+
+        timingHistogram.addCallback (startTime, numSamples);
+    }
+
+    void processBlockReplacing (float** inputs, float** outputs, const int numSamples)
     {
         if (firstProcessCallback)
         {
@@ -614,21 +819,33 @@ public:
             if (GetThreadPriority (GetCurrentThread()) <= THREAD_PRIORITY_NORMAL)
                 filter->setNonRealtime (true);
 #endif
+
+            startupTimings.mark (PluginStartupTimings::firstBlockStarted);
         }
 
+#if JucePlugin_WantsMidiInput
+        incomingEvents.removeAllInto (midiEvents);
+#endif
+
 #if JUCE_DEBUG && ! JucePlugin_ProducesMidiOutput
         const int numMidiEventsComingIn = midiEvents.getNumEvents();
 #endif
 
         jassert (activePlugins.contains (this));
 
+        // if the message thread is busy reconfiguring things, this block is just
+        // dropped - we never wait for it
+        if (! processingGate.tryToEnter())
+        {
+            for (int i = 0; i < numOutChans; ++i)
+                zeromem (outputs[i], sizeof (float) * numSamples);
+        }
+        else
         {
-            const ScopedLock sl (filter->getCallbackLock());
-
             const int numIn = numInChans;
             const int numOut = numOutChans;
 
-            if (filter->isSuspended())
+            if (channels == 0 || filter->isSuspended())
             {
                 for (int i = 0; i < numOut; ++i)
                     zeromem (outputs[i], sizeof (float) * numSamples);
@@ -682,14 +899,17 @@ public:
 
                 filter->processBlock (chans, midiEvents);
             }
+
+            processingGate.exit();
         }
 
+        // (with no midi in or out, this is only non-empty if the filter has
+        //  wrongly added some events, and they just get thrown away)
         if (! midiEvents.isEmpty())
         {
 #if JucePlugin_ProducesMidiOutput
-            const int numEvents = midiEvents.getNumEvents();
-
-            ensureOutgoingEventSize (numEvents);
+            // the outgoing events were all allocated in resume(), and any that
+            // don't fit are dropped rather than growing the list in here
             outgoingEvents->numEvents = 0;
 
             const uint8* midiEventData;
@@ -698,7 +918,11 @@ public:
 
             while (i.getNextEvent (midiEventData, midiEventSize, midiEventPosition))
             {
-                if (midiEventSize <= 4)
+                if (outgoingEvents->numEvents >= outgoingEventSize)
+                {
+                    ++numOutgoingEventsDropped;
+                }
+                else if (midiEventSize <= 4)
                 {
                     VstMidiEvent* const vme = (VstMidiEvent*) outgoingEvents->events [outgoingEvents->numEvents++];
 
@@ -741,6 +965,8 @@ public:
         if (filter == 0)
             return;
 
+        const ProcessingGate::ScopedClose gateClosed (processingGate);
+
         isProcessing = true;
         juce_free (channels);
         channels = (float**) juce_calloc (sizeof (float*) * (numInChans + numOutChans));
@@ -765,12 +991,28 @@ public:
         filter->prepareToPlay (rate, blockSize);
         midiEvents.clear();
 
+#if JucePlugin_WantsMidiInput || JucePlugin_ProducesMidiOutput
+        // allocate the space for a block's worth of events now, so the process
+        // callback never has to (each one takes a timestamp, a size and its data)
+        const int maxEventsPerBlock = jmax (256, blockSize);
+        midiEvents.ensureSize (maxEventsPerBlock * 2 * (sizeof (int) * 2 + 4));
+#endif
+
+#if JucePlugin_WantsMidiInput
+        incomingEvents.setCapacity (maxEventsPerBlock);
+#endif
+
+        timingHistogram.setPlayConfig (rate, blockSize);
+
         setInitialDelay (filter->getLatencySamples());
 
         AudioEffectX::resume();
 
+        startupTimings.mark (PluginStartupTimings::resumed);
+
 #if JucePlugin_ProducesMidiOutput
-        ensureOutgoingEventSize (64);
+        ensureOutgoingEventSize (maxEventsPerBlock);
+        numOutgoingEventsDropped = 0;
 #endif
 
 #if JucePlugin_WantsMidiInput && ! JUCE_USE_VSTSDK_2_4
@@ -783,11 +1025,25 @@ public:
         if (filter == 0)
             return;
 
+        const ProcessingGate::ScopedClose gateClosed (processingGate);
+
         AudioEffectX::suspend();
 
         filter->releaseResources();
         midiEvents.clear();
 
+#if JucePlugin_WantsMidiInput
+        if (incomingEvents.getNumDropped() > 0)
+            DBG (String (incomingEvents.getNumDropped()) + T(" incoming midi events were dropped"));
+
+        incomingEvents.clear();
+#endif
+
+#if JucePlugin_ProducesMidiOutput
+        if (numOutgoingEventsDropped > 0)
+            DBG (String (numOutgoingEventsDropped) + T(" outgoing midi events were dropped"));
+#endif
+
         isProcessing = false;
         juce_free (channels);
         channels = 0;
@@ -1004,6 +1260,8 @@ public:
     {
         // if this method isn't implemented, nuendo4 + cubase4 crash when you've got multiple channels..
 
+        const ProcessingGate::ScopedClose gateClosed (processingGate);
+
         numInChans = pluginInput->numChannels;
         numOutChans = pluginOutput->numChannels;
 
@@ -1020,7 +1278,10 @@ public:
         if (filter == 0)
             return 0;
 
-        chunkMemory.setSize (0);
+        // the block is kept from one call to the next and only freed in close(), so
+        // as long as the state stays the same size, this doesn't allocate. (This
+        // means that getStateInformation() has to set the block's size, rather than
+        // appending to it)
         if (onlyStoreCurrentProgramData)
             filter->getCurrentProgramStateInformation (chunkMemory);
         else
@@ -1028,10 +1289,6 @@ public:
 
         *data = (void*) chunkMemory;
 
-        // because the chunk is only needed temporarily by the host (or at least you'd
-        // hope so) we'll give it a while and then free it in the timer callback.
-        chunkMemoryTime = JUCE_NAMESPACE::Time::getApproximateMillisecondCounter();
-
         return chunkMemory.getSize();
     }
 
@@ -1040,9 +1297,8 @@ public:
         if (filter == 0)
             return 0;
 
-        chunkMemory.setSize (0);
-        chunkMemoryTime = 0;
-
+        // this isn't kept out of the process callback - like setParameter(), the
+        // filter has to cope with its state being loaded while it's running
         if (byteSize > 0 && data != 0)
         {
             if (onlyRestoreCurrentProgramData)
@@ -1054,19 +1310,6 @@ public:
         return 0;
     }
 
-    void timerCallback()
-    {
-        if (chunkMemoryTime > 0
-             && chunkMemoryTime < JUCE_NAMESPACE::Time::getApproximateMillisecondCounter() - 2000
-             && ! recursionCheck)
-        {
-            chunkMemoryTime = 0;
-            chunkMemory.setSize (0);
-        }
-
-        tryMasterIdle();
-    }
-
     void tryMasterIdle()
     {
         if (Component::isMouseButtonDownAnywhere()
@@ -1088,7 +1331,8 @@ public:
     void doIdleCallback()
     {
         // (wavelab calls this on a separate thread and causes a deadlock)..
-        if (MessageManager::getInstance()->isThisTheMessageThread()
+        if (isGuiInitialised
+             && MessageManager::getInstance()->isThisTheMessageThread()
              && ! recursionCheck)
         {
             const MessageManagerLock mml;
@@ -1111,6 +1355,9 @@ public:
 
         if (editorComp == 0)
         {
+            if (initialiseGuiIfNeeded())
+                startupTimings.mark (PluginStartupTimings::guiInitialised);
+
 #if JUCE_LINUX
             const MessageManagerLock mml;
 #endif
@@ -1123,12 +1370,19 @@ public:
                 ed->setVisible (true);
 
                 editorComp = new EditorCompWrapper (this, ed);
+                SharedIdleTimer::getInstance()->editorOpened();
+
+                startupTimings.mark (PluginStartupTimings::editorOpened);
             }
         }
     }
 
     void deleteEditor()
     {
+        // (if the gui has never been started, there can't be an editor to delete)
+        if (! isGuiInitialised)
+            return;
+
         PopupMenu::dismissAllActiveMenus();
 
         jassert (! recursionCheck);
@@ -1147,6 +1401,7 @@ public:
             filter->editorBeingDeleted (editorComp->getEditorComp());
 
             deleteAndZero (editorComp);
+            SharedIdleTimer::getInstance()->editorClosed();
 
             // there's some kind of component currently modal, but the host
             // is trying to delete our plugin. You should try to avoid this happening..
@@ -1373,18 +1628,31 @@ public:
     }
 
 
+    //==============================================================================
+    AudioProcessor* getFilter() const throw()                       { return filter; }
+
+    /** Returns the record of how long each of our process callbacks has taken. */
+    ProcessTimingHistogram& getTimingHistogram() throw()            { return timingHistogram; }
+
+    /** Returns the record of how long this instance took to get going. */
+    PluginStartupTimings& getStartupTimings() throw()               { return startupTimings; }
+
     //==============================================================================
     juce_UseDebuggingNewOperator
 
 private:
     AudioProcessor* filter;
     juce::MemoryBlock chunkMemory;
-    uint32 chunkMemoryTime;
     EditorCompWrapper* editorComp;
     ERect editorSize;
     MidiBuffer midiEvents;
+#if JucePlugin_WantsMidiInput
+    MidiEventRing incomingEvents;
+#endif
+#if JucePlugin_ProducesMidiOutput
     VstEvents* outgoingEvents;
-    int outgoingEventSize;
+    int outgoingEventSize, numOutgoingEventsDropped;
+#endif
     bool isProcessing;
     bool firstResize;
     bool hasShutdown;
@@ -1392,8 +1660,11 @@ private:
     int diffW, diffH;
     int numInChans, numOutChans;
     float** channels;
-    VoidArray tempChannels; // see note in processReplacing()
+    VoidArray tempChannels; // see note in processBlockReplacing()
     bool hasCreatedTempChannels;
+    ProcessTimingHistogram timingHistogram;
+    ProcessingGate processingGate;
+    PluginStartupTimings startupTimings;
 
     void deleteTempChannels()
     {
@@ -1409,6 +1680,7 @@ private:
         hasCreatedTempChannels = false;
     }
 
+#if JucePlugin_ProducesMidiOutput
     void ensureOutgoingEventSize (int numEvents)
     {
         if (outgoingEventSize < numEvents)
@@ -1433,6 +1705,7 @@ private:
             outgoingEventSize = numEvents;
         }
     }
+#endif
 
     const String getHostName()
     {
@@ -1472,6 +1745,40 @@ void EditorCompWrapper::handleAsyncUpdate()
     wrapper->tryMasterIdle();
 }
 
+//==============================================================================
+void SharedIdleTimer::timerCallback()
+{
+    for (int i = activePlugins.size(); --i >= 0;)
+        ((JuceVSTWrapper*) activePlugins.getUnchecked (i))->tryMasterIdle();
+}
+
+//==============================================================================
+ProcessTimingHistogram* JUCE_CALLTYPE getProcessTimingHistogramFor (const AudioProcessor* processor)
+{
+    for (int i = activePlugins.size(); --i >= 0;)
+    {
+        JuceVSTWrapper* const w = (JuceVSTWrapper*) activePlugins.getUnchecked (i);
+
+        if (w->getFilter() == processor)
+            return &(w->getTimingHistogram());
+    }
+
+    return 0;
+}
+
+const PluginStartupTimings* JUCE_CALLTYPE getStartupTimingsFor (const AudioProcessor* processor)
+{
+    for (int i = activePlugins.size(); --i >= 0;)
+    {
+        JuceVSTWrapper* const w = (JuceVSTWrapper*) activePlugins.getUnchecked (i);
+
+        if (w->getFilter() == processor)
+            return &(w->getStartupTimings());
+    }
+
+    return 0;
+}
+
 //==============================================================================
 /** Somewhere in the codebase of your plugin, you need to implement this function
     and make it create an instance of the filter subclass that you're building.
@@ -1482,23 +1789,31 @@ extern AudioProcessor* JUCE_CALLTYPE createPluginFilter();
 //==============================================================================
 static AEffect* pluginEntryPoint (audioMasterCallback audioMaster)
 {
-    initialiseJuce_GUI();
+    PluginStartupTimings timings;
+    timings.mark (PluginStartupTimings::entryPointCalled);
+
+    // the gui isn't started until an editor is opened - see initialiseGuiIfNeeded()
+    initialiseJuce_NonGUI();
 
 #if JUCE_MAC && defined (JucePlugin_CFBundleIdentifier)
     juce_setCurrentExecutableFileNameFromBundleId (JucePlugin_CFBundleIdentifier);
 #endif
 
-    MessageManager::getInstance()->setTimeBeforeShowingWaitCursor (0);
+    timings.mark (PluginStartupTimings::juceInitialised);
 
     try
     {
         if (audioMaster (0, audioMasterVersion, 0, 0, 0, 0) != 0)
         {
             AudioProcessor* const filter = createPluginFilter();
+            timings.mark (PluginStartupTimings::filterCreated);
 
             if (filter != 0)
             {
                 JuceVSTWrapper* const wrapper = new JuceVSTWrapper (audioMaster, filter);
+                timings.mark (PluginStartupTimings::wrapperCreated);
+
+                wrapper->getStartupTimings().markFrom (timings);
                 return wrapper->getAeffect();
             }
         }
@@ -1530,9 +1845,7 @@ extern "C" __attribute__ ((visibility("default"))) AEffect* main_macho (audioMas
 
 extern "C" AEffect* VSTPluginMain (audioMasterCallback audioMaster)
 {
-    initialiseJuce_GUI();
-    SharedMessageThread::getInstance();
-
+    // (the gui and the message thread get started when the first editor is opened)
     return pluginEntryPoint (audioMaster);
 }
 
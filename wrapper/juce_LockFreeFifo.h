@@ -0,0 +1,212 @@
+#ifndef __JUCE_LOCKFREEFIFO_JUCEHEADER__
+#define __JUCE_LOCKFREEFIFO_JUCEHEADER__
+
+#include <juce.h>
+
+#if defined (_MSC_VER) && _MSC_VER >= 1400
+ #include <intrin.h>
+ #pragma intrinsic (_ReadWriteBarrier, _InterlockedOr)
+#endif
+
+
+//==============================================================================
+/**
+    Stops the compiler and the cpu from moving memory accesses across this
+    point, so that data written before it is visible to another thread that
+    sees a write made after it.
+*/
+static inline void lockFreeMemoryBarrier() throw()
+{
+#if defined (__GNUC__)
+    __sync_synchronize();
+#elif defined (_MSC_VER) && _MSC_VER >= 1400
+    // This is what MemoryBarrier() does, without needing windows.h in every file
+    // that uses a fifo: a locked instruction is a full fence for the cpu, and the
+    // intrinsic and _ReadWriteBarrier() stop the compiler moving anything across it.
+    volatile long barrier = 0;
+    _ReadWriteBarrier();
+    _InterlockedOr (&barrier, 0);
+    _ReadWriteBarrier();
+#elif defined (_MSC_VER)
+    // older compilers (e.g. VC6) don't have the intrinsics, but they're x86-only,
+    // and a compiler won't move memory accesses across inline asm
+    __asm { lock or dword ptr [esp], 0 }
+#else
+    #error "lockFreeMemoryBarrier() needs a memory fence for this compiler"
+#endif
+}
+
+//==============================================================================
+/**
+    Manages the read and write positions of a single-reader, single-writer
+    circular buffer.
+
+    This doesn't hold any data itself - you keep your own array of whatever
+    the buffer contains, of the size passed to the constructor, and this just
+    tells each side which parts of it they can use. One thread may write and
+    one (other) thread may read, at the same time, without any locking.
+
+    e.g. @code
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (numItems, start1, size1, start2, size2);
+
+    if (size1 > 0)
+        copyItems (myBuffer + start1, source, size1);
+
+    if (size2 > 0)
+        copyItems (myBuffer + start2, source + size1, size2);
+
+    fifo.finishedWrite (size1 + size2);
+    @endcode
+
+    One slot is always left empty, so a fifo of size n holds at most n - 1 items.
+*/
+class LockFreeFifo
+{
+public:
+    //==============================================================================
+    /** Creates a fifo to manage a buffer of the given number of items. */
+    LockFreeFifo (const int capacity = 0) throw()
+        : bufferSize (jmax (1, capacity)),
+          validStart (0),
+          validEnd (0)
+    {
+    }
+
+    ~LockFreeFifo() throw()
+    {
+    }
+
+    //==============================================================================
+    /** Returns the size of the buffer being managed. */
+    int getTotalSize() const throw()                { return bufferSize; }
+
+    /** Returns the number of items that could be written right now. */
+    int getFreeSpace() const throw()                { return bufferSize - getNumReady() - 1; }
+
+    /** Returns the number of items that are waiting to be read. */
+    int getNumReady() const throw()
+    {
+        const int start = validStart;
+        const int end = validEnd;
+
+        return end >= start ? (end - start) : (bufferSize - (start - end));
+    }
+
+    /** Empties the fifo.
+
+        Neither side may be using it while this is called.
+    */
+    void reset() throw()
+    {
+        validStart = 0;
+        validEnd = 0;
+    }
+
+    /** Changes the size of the buffer being managed, and empties it.
+
+        Neither side may be using it while this is called.
+    */
+    void setTotalSize (const int newSize) throw()
+    {
+        bufferSize = jmax (1, newSize);
+        reset();
+    }
+
+    //==============================================================================
+    /** Returns the regions of the buffer that up to numToWrite items can be written into.
+
+        The space may be split into two blocks where the buffer wraps around, and
+        if there's not enough room, the sizes add up to less than numToWrite. Call
+        finishedWrite() once the data has been written.
+    */
+    void prepareToWrite (int numToWrite, int& startIndex1, int& blockSize1,
+                         int& startIndex2, int& blockSize2) const throw()
+    {
+        const int start = validStart;
+        const int end = validEnd;
+
+        const int freeSpace = start <= end ? (bufferSize - (end - start) - 1) : (start - end - 1);
+        numToWrite = jmin (numToWrite, freeSpace);
+
+        if (numToWrite <= 0)
+        {
+            startIndex1 = startIndex2 = 0;
+            blockSize1 = blockSize2 = 0;
+            return;
+        }
+
+        startIndex1 = end;
+        blockSize1 = jmin (bufferSize - end, numToWrite);
+        startIndex2 = 0;
+        blockSize2 = numToWrite - blockSize1;
+    }
+
+    /** Makes a block of items written after prepareToWrite() available to the reader. */
+    void finishedWrite (int numWritten) throw()
+    {
+        jassert (numWritten >= 0 && numWritten < bufferSize);
+
+        int newEnd = validEnd + numWritten;
+        if (newEnd >= bufferSize)
+            newEnd -= bufferSize;
+
+        lockFreeMemoryBarrier();   // the data must be in place before the reader can see it
+        validEnd = newEnd;
+    }
+
+    /** Returns the regions of the buffer that up to numWanted items can be read from.
+
+        As with prepareToWrite(), there may be two blocks, and fewer items than
+        requested. Call finishedRead() once they've been used.
+    */
+    void prepareToRead (int numWanted, int& startIndex1, int& blockSize1,
+                        int& startIndex2, int& blockSize2) const throw()
+    {
+        const int start = validStart;
+        const int end = validEnd;
+
+        const int numReady = end >= start ? (end - start) : (bufferSize - (start - end));
+        numWanted = jmin (numWanted, numReady);
+
+        lockFreeMemoryBarrier();   // don't read any of the data before we've seen validEnd
+
+        if (numWanted <= 0)
+        {
+            startIndex1 = startIndex2 = 0;
+            blockSize1 = blockSize2 = 0;
+            return;
+        }
+
+        startIndex1 = start;
+        blockSize1 = jmin (bufferSize - start, numWanted);
+        startIndex2 = 0;
+        blockSize2 = numWanted - blockSize1;
+    }
+
+    /** Hands a block of items that have been read back to the writer. */
+    void finishedRead (int numRead) throw()
+    {
+        jassert (numRead >= 0 && numRead <= bufferSize);
+
+        int newStart = validStart + numRead;
+        if (newStart >= bufferSize)
+            newStart -= bufferSize;
+
+        lockFreeMemoryBarrier();   // finish reading before the writer can reuse the space
+        validStart = newStart;
+    }
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    int bufferSize;
+    volatile int validStart, validEnd;
+
+    LockFreeFifo (const LockFreeFifo&);
+    const LockFreeFifo& operator= (const LockFreeFifo&);
+};
+
+
+#endif   // __JUCE_LOCKFREEFIFO_JUCEHEADER__
@@ -0,0 +1,284 @@
+#ifndef __JUCE_PROCESSTIMINGHISTOGRAM_JUCEHEADER__
+#define __JUCE_PROCESSTIMINGHISTOGRAM_JUCEHEADER__
+
+#include <juce.h>
+
+#if defined (_MSC_VER) && _MSC_VER >= 1400
+ #include <intrin.h>
+#endif
+
+
+//==============================================================================
+/**
+    Keeps an HDR-style histogram of how long each audio callback took, and how
+    that compares with the time the buffer represents.
+
+    Durations go into log-linear buckets: 16 linear steps per power of two, so
+    any reading is within about 6% of the real value, from nanoseconds up to
+    about a minute, in a fixed 2K block of counters.
+
+    Only one thread (the audio thread) may call addCallback(), and it never
+    locks or allocates, so this can stay switched on in release builds. Any
+    other thread can read it with getSummary() at any time - the figures might
+    be a callback or so out of step with each other, but that's all.
+*/
+class ProcessTimingHistogram
+{
+public:
+    //==============================================================================
+    ProcessTimingHistogram()
+        : nanosPerSample (1.0e9 / 44100.0),
+          nominalBlockSize (512),
+          resetPending (0)
+    {
+        nanosPerTick = 1.0e9 / (double) Time::getHighResolutionTicksPerSecond();
+        clear();
+    }
+
+    //==============================================================================
+    /** Tells the histogram the rate that callback deadlines should be worked out at.
+
+        The block size is just used to show the percentiles relative to a typical
+        callback - each callback's own deadline comes from its numSamples.
+    */
+    void setPlayConfig (double sampleRate, int blockSize) throw()
+    {
+        if (sampleRate > 0)
+            nanosPerSample = 1.0e9 / sampleRate;
+
+        if (blockSize > 0)
+            nominalBlockSize = blockSize;
+    }
+
+    /** Returns a timestamp to pass to addCallback() when the callback finishes. */
+    static inline int64 getStartTime() throw()
+    {
+        return Time::getHighResolutionTicks();
+    }
+
+    /** Records a callback that began at startTime and has just finished. */
+    void addCallback (const int64 startTime, const int numSamples) throw()
+    {
+        const int64 nanos = (int64) ((Time::getHighResolutionTicks() - startTime) * nanosPerTick);
+        const double deadline = numSamples * nanosPerSample;
+
+        if (resetPending != 0)
+        {
+            clear();
+            resetPending = 0;
+        }
+
+        ++buckets [getBucketIndex (nanos)];
+        ++numCallbacks;
+        totalNanos += nanos;
+        totalDeadlineNanos += (int64) deadline;
+
+        if (nanos < minNanos)
+            minNanos = nanos;
+
+        if (nanos > maxNanos)
+            maxNanos = nanos;
+
+        if (nanos > deadline)
+            ++numOverruns;
+        else if (nanos > deadline * 0.8)   // (anything within 20% counts as a near miss)
+            ++numNearMisses;
+
+        const float load = (float) (nanos / deadline);
+
+        if (load > peakLoad)
+            peakLoad = load;
+    }
+
+    /** Asks the audio thread to clear everything before it next records something. */
+    void reset() throw()
+    {
+        resetPending = 1;
+    }
+
+    //==============================================================================
+    /** A digest of the histogram. Times are in microseconds, loads are proportions of the deadline. */
+    struct Summary
+    {
+        int numCallbacks, numOverruns, numNearMisses;
+        double minMicros, meanMicros, p50Micros, p99Micros, p999Micros, maxMicros;
+        double nominalDeadlineMicros, meanLoad, peakLoad;
+    };
+
+    void getSummary (Summary& s) const
+    {
+        int counts [numBuckets];
+        int total = 0;
+
+        for (int i = 0; i < numBuckets; ++i)
+        {
+            counts[i] = buckets[i];
+            total += counts[i];
+        }
+
+        s.numCallbacks = total;
+        s.numOverruns = numOverruns;
+        s.numNearMisses = numNearMisses;
+        s.nominalDeadlineMicros = nominalBlockSize * nanosPerSample * 0.001;
+        s.peakLoad = peakLoad;
+
+        if (total == 0)
+        {
+            s.minMicros = s.meanMicros = s.p50Micros = s.p99Micros = s.p999Micros = s.maxMicros = 0;
+            s.meanLoad = 0;
+            return;
+        }
+
+        const int64 deadlineSum = totalDeadlineNanos;
+
+        s.minMicros = minNanos * 0.001;
+        s.maxMicros = maxNanos * 0.001;
+        s.meanMicros = totalNanos * 0.001 / jmax (1, (int) numCallbacks);
+        s.meanLoad = deadlineSum > 0 ? totalNanos / (double) deadlineSum : 0.0;
+        s.p50Micros = jmin (s.maxMicros, getPercentile (counts, total, 0.5) * 0.001);
+        s.p99Micros = jmin (s.maxMicros, getPercentile (counts, total, 0.99) * 0.001);
+        s.p999Micros = jmin (s.maxMicros, getPercentile (counts, total, 0.999) * 0.001);
+    }
+
+    /** Returns a few lines of text describing the summary. */
+    const String getSummaryText() const
+    {
+        Summary s;
+        getSummary (s);
+
+        const double deadline = jmax (0.001, s.nominalDeadlineMicros);
+
+        return String::formatted (T("callbacks: %d, overruns: %d, near misses: %d\n"),
+                                  s.numCallbacks, s.numOverruns, s.numNearMisses)
+             + String::formatted (T("min %.1fus, avg %.1fus, p99 %.1fus, p99.9 %.1fus, max %.1fus\n"),
+                                  s.minMicros, s.meanMicros, s.p99Micros, s.p999Micros, s.maxMicros)
+             + String::formatted (T("deadline %.1fus: avg load %.1f%%, p99.9 %.1f%%, peak %.1f%%\n"),
+                                  s.nominalDeadlineMicros, 100.0 * s.meanLoad,
+                                  100.0 * s.p999Micros / deadline, 100.0 * s.peakLoad);
+    }
+
+    /** Writes the summary and the raw bucket counts to a text file.
+
+        This does file i/o, so call it from the message thread, never the audio one.
+    */
+    bool writeToFile (const File& file) const
+    {
+        String text (getSummaryText());
+        text << T("\nbucket start (ns)\tcount\n");
+
+        for (int i = 0; i < numBuckets; ++i)
+        {
+            const int count = buckets[i];
+
+            if (count > 0)
+                text << String (getBucketStart (i)) << T("\t") << String (count) << T("\n");
+        }
+
+        return file.replaceWithText (text);
+    }
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    enum
+    {
+        subBucketBits = 4,
+        numSubBuckets = 1 << subBucketBits,
+        numOctaves = 36,                    // 2^36ns is over a minute
+        numBuckets = numSubBuckets * (numOctaves - subBucketBits + 2)
+    };
+
+    volatile int buckets [numBuckets];
+    volatile int numCallbacks, numOverruns, numNearMisses;
+    volatile int64 totalNanos, totalDeadlineNanos, minNanos, maxNanos;
+    volatile float peakLoad;
+    double nanosPerTick, nanosPerSample;
+    int nominalBlockSize;
+    volatile int resetPending;
+
+    void clear() throw()
+    {
+        for (int i = 0; i < numBuckets; ++i)
+            buckets[i] = 0;
+
+        numCallbacks = numOverruns = numNearMisses = 0;
+        totalNanos = totalDeadlineNanos = maxNanos = 0;
+        minNanos = (((int64) 1) << 62);
+        peakLoad = 0;
+    }
+
+    static inline int getHighestBit (uint64 n) throw()
+    {
+#if defined (__GNUC__)
+        return 63 - __builtin_clzll (n);
+#elif defined (_MSC_VER) && _MSC_VER >= 1400 && defined (_WIN64)
+        unsigned long index;
+        _BitScanReverse64 (&index, n);
+        return (int) index;
+#elif defined (_MSC_VER) && _MSC_VER >= 1400
+        unsigned long index;
+        if (_BitScanReverse (&index, (unsigned long) (n >> 32)))
+            return (int) index + 32;
+
+        _BitScanReverse (&index, (unsigned long) n);
+        return (int) index;
+#else
+        int bit = 0;
+        while ((n >>= 1) != 0)
+            ++bit;
+
+        return bit;
+#endif
+    }
+
+    static inline int getBucketIndex (int64 nanos) throw()
+    {
+        if (nanos < numSubBuckets)
+            return nanos > 0 ? (int) nanos : 0;
+
+        const int shift = jmin ((int) numOctaves, getHighestBit ((uint64) nanos)) - subBucketBits;
+        const int index = ((shift + 1) << subBucketBits) + ((int) (nanos >> shift) & (numSubBuckets - 1));
+
+        return jmin (numBuckets - 1, index);
+    }
+
+    static int64 getBucketStart (int index) throw()
+    {
+        if (index < numSubBuckets)
+            return index;
+
+        const int shift = (index >> subBucketBits) - 1;
+        return ((int64) (numSubBuckets + (index & (numSubBuckets - 1)))) << shift;
+    }
+
+    static double getPercentile (const int* counts, int total, double proportion) throw()
+    {
+        const int target = jmax (1, (int) (total * proportion + 0.5));
+        int sum = 0;
+
+        for (int i = 0; i < numBuckets; ++i)
+        {
+            sum += counts[i];
+
+            if (sum >= target)
+                return (double) getBucketStart (i + 1);   // report the bucket's upper edge
+        }
+
+        return (double) getBucketStart (numBuckets - 1);
+    }
+
+    ProcessTimingHistogram (const ProcessTimingHistogram&);
+    const ProcessTimingHistogram& operator= (const ProcessTimingHistogram&);
+};
+
+//==============================================================================
+/** Returns the histogram that the plugin wrapper keeps for the given processor,
+    or 0 if it isn't keeping one.
+
+    Each wrapper format provides this. Only call it from the message thread.
+*/
+ProcessTimingHistogram* JUCE_CALLTYPE getProcessTimingHistogramFor (const AudioProcessor* processor);
+
+
+#endif   // __JUCE_PROCESSTIMINGHISTOGRAM_JUCEHEADER__
@@ -0,0 +1,117 @@
+#ifndef __JUCE_PROCESSINGGATE_JUCEHEADER__
+#define __JUCE_PROCESSINGGATE_JUCEHEADER__
+
+#include "juce_LockFreeFifo.h"
+
+
+//==============================================================================
+/**
+    Lets the audio thread and the message thread take turns with a filter
+    without the audio thread ever having to wait.
+
+    The audio thread calls tryToEnter() before each block. If that succeeds it
+    processes and then calls exit(); if it fails, something is reconfiguring
+    the filter and the block should just be filled with silence.
+
+    Anything that changes what the callback depends on (suspending, resuming,
+    changing the channel layout) closes the gate with a ScopedClose. That stops
+    any new blocks from starting, and waits for one that's in progress to
+    finish, so it's only the message thread that ever waits.
+
+    Each side bumps its own counter and then checks the other one's, with a
+    full barrier in between, so at least one of them always sees the other.
+*/
+class ProcessingGate
+{
+public:
+    //==============================================================================
+    ProcessingGate() throw()
+        : numActive (0),
+          numClosers (0)
+    {
+    }
+
+    ~ProcessingGate() throw()
+    {
+        jassert (numActive == 0);
+    }
+
+    //==============================================================================
+    /** Called by the audio thread before it processes a block.
+
+        If this returns true, you must call exit() when you've finished. If it
+        returns false, don't touch the filter.
+    */
+    bool tryToEnter() throw()
+    {
+        atomicIncrement (numActive);
+        lockFreeMemoryBarrier();
+
+        if (read (numClosers) == 0)
+            return true;
+
+        atomicDecrement (numActive);
+        return false;
+    }
+
+    /** Called by the audio thread when it's finished a block that tryToEnter() let it start. */
+    void exit() throw()
+    {
+        lockFreeMemoryBarrier();
+        atomicDecrement (numActive);
+    }
+
+    //==============================================================================
+    /** Stops the audio thread from starting any more blocks, and waits until it's
+        out of the one it's in. Each call must be matched by a call to open().
+
+        Don't call this from inside a block that the gate let in, or it'll wait forever.
+    */
+    void close() throw()
+    {
+        atomicIncrement (numClosers);
+        lockFreeMemoryBarrier();
+
+        while (read (numActive) != 0)
+            Thread::yield();
+    }
+
+    /** Lets the audio thread back in after a call to close(). */
+    void open() throw()
+    {
+        lockFreeMemoryBarrier();   // finish the changes before the callback can see them
+        atomicDecrement (numClosers);
+    }
+
+    //==============================================================================
+    /** Closes a gate for the lifetime of this object. */
+    class ScopedClose
+    {
+    public:
+        inline ScopedClose (ProcessingGate& gate_) throw()   : gate (gate_)     { gate.close(); }
+        inline ~ScopedClose() throw()                                           { gate.open(); }
+
+    private:
+        ProcessingGate& gate;
+
+        ScopedClose (const ScopedClose&);
+        const ScopedClose& operator= (const ScopedClose&);
+    };
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    int numActive, numClosers;
+
+    static inline int read (const int& value) throw()
+    {
+        return *(const volatile int*) &value;
+    }
+
+    ProcessingGate (const ProcessingGate&);
+    const ProcessingGate& operator= (const ProcessingGate&);
+};
+
+
+#endif   // __JUCE_PROCESSINGGATE_JUCEHEADER__
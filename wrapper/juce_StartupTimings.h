@@ -0,0 +1,114 @@
+#ifndef __JUCE_STARTUPTIMINGS_JUCEHEADER__
+#define __JUCE_STARTUPTIMINGS_JUCEHEADER__
+
+#include <juce.h>
+
+
+//==============================================================================
+/**
+    Records when a plugin instance got through each stage of starting up, from
+    the host calling its entry point to the first block being processed.
+
+    Each phase is timestamped the first time mark() is called for it, and later
+    calls are ignored. mark() doesn't lock or allocate, so the audio thread can
+    use it for the processing phase.
+*/
+class PluginStartupTimings
+{
+public:
+    //==============================================================================
+    enum Phase
+    {
+        entryPointCalled = 0,   /**< the host has called the plugin's entry point. */
+        juceInitialised,        /**< the non-gui parts of juce are ready. */
+        filterCreated,          /**< createPluginFilter() has returned. */
+        wrapperCreated,         /**< the format wrapper has been constructed. */
+        opened,                 /**< the host has opened the plugin. */
+        resumed,                /**< processing has been switched on. */
+        firstBlockStarted,      /**< the first block has arrived to be processed. */
+        guiInitialised,         /**< the gui was started up for the first editor. */
+        editorOpened,           /**< the first editor has been created. */
+
+        numPhases
+    };
+
+    //==============================================================================
+    PluginStartupTimings() throw()
+    {
+        for (int i = 0; i < numPhases; ++i)
+            times[i] = 0;
+    }
+
+    /** Timestamps a phase, if it hasn't already been marked. */
+    void mark (const Phase phase) throw()
+    {
+        if (times [phase] == 0)
+            times [phase] = Time::getHighResolutionTicks();
+    }
+
+    /** Copies the times of any phases that have happened from another set. */
+    void markFrom (const PluginStartupTimings& other) throw()
+    {
+        for (int i = 0; i < numPhases; ++i)
+            if (times[i] == 0)
+                times[i] = other.times[i];
+    }
+
+    /** Returns true if the phase has happened yet. */
+    bool hasHappened (const Phase phase) const throw()      { return times [phase] != 0; }
+
+    /** Returns the number of milliseconds between the entry point being called and a phase,
+        or -1 if either hasn't happened.
+    */
+    double getMillisecondsTo (const Phase phase) const throw()
+    {
+        const int64 start = times [entryPointCalled];
+        const int64 t = times [phase];
+
+        if (start == 0 || t == 0)
+            return -1.0;
+
+        return (t - start) * 1000.0 / (double) Time::getHighResolutionTicksPerSecond();
+    }
+
+    /** Returns a line for each phase that has happened, with the time since the one before. */
+    const String getDescription() const
+    {
+        static const tchar* const phaseNames[] = { T("entry point"), T("juce initialised"), T("filter created"),
+                                                   T("wrapper created"), T("opened"), T("resumed"),
+                                                   T("first block"), T("gui initialised"), T("editor opened") };
+
+        String s;
+        double last = 0;
+
+        for (int i = 0; i < numPhases; ++i)
+        {
+            const double ms = getMillisecondsTo ((Phase) i);
+
+            if (ms >= 0)
+            {
+                s << phaseNames[i] << String::formatted (T(": %.2fms (+%.2fms)\n"), ms, jmax (0.0, ms - last));
+                last = ms;
+            }
+        }
+
+        return s;
+    }
+
+    //==============================================================================
+    juce_UseDebuggingNewOperator
+
+private:
+    volatile int64 times [numPhases];
+};
+
+//==============================================================================
+/** Returns the startup timings that the plugin wrapper kept for the given processor,
+    or 0 if it isn't keeping any.
+
+    Each wrapper format provides this. Only call it from the message thread.
+*/
+const PluginStartupTimings* JUCE_CALLTYPE getStartupTimingsFor (const AudioProcessor* processor);
+
+
+#endif   // __JUCE_STARTUPTIMINGS_JUCEHEADER__